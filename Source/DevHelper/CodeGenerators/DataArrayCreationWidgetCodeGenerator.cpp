@@ -94,6 +94,30 @@ QList<QString> DataArrayCreationWidgetCodeGenerator::generateCPPIncludes()
   return list;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayCreationWidgetCodeGenerator::generateFilterAccessorDeclarations()
+{
+  return FPCodeGenerator::generateFilterAccessorDeclarations() + "\n\n" + generateDataArrayAccessorDeclaration();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayCreationWidgetCodeGenerator::generateFilterParameterDefinitions()
+{
+  return FPCodeGenerator::generateFilterParameterDefinitions() + "\n" + generateDataArrayAccessorDefinition();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArrayCreationWidgetCodeGenerator::generatePybindContents()
+{
+  return FPCodeGenerator::generatePybindContents() + generateDataArrayPybindContents();
+}
+
 // -----------------------------------------------------------------------------
 DataArrayCreationWidgetCodeGenerator::Pointer DataArrayCreationWidgetCodeGenerator::NullPointer()
 {
@@ -67,6 +67,12 @@ public:
 
   QList<QString> generateCPPIncludes() override;
 
+  QString generateFilterAccessorDeclarations() override;
+
+  QString generateFilterParameterDefinitions() override;
+
+  QString generatePybindContents() override;
+
 protected:
   DataArrayCreationWidgetCodeGenerator(const QString& humanLabel, const QString& propertyName, const QString& category, const QString& initValue);
 
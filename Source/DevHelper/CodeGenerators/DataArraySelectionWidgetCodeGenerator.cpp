@@ -94,6 +94,30 @@ QList<QString> DataArraySelectionWidgetCodeGenerator::generateCPPIncludes()
   return list;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArraySelectionWidgetCodeGenerator::generateFilterAccessorDeclarations()
+{
+  return FPCodeGenerator::generateFilterAccessorDeclarations() + "\n\n" + generateDataArrayAccessorDeclaration();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArraySelectionWidgetCodeGenerator::generateFilterParameterDefinitions()
+{
+  return FPCodeGenerator::generateFilterParameterDefinitions() + "\n" + generateDataArrayAccessorDefinition();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString DataArraySelectionWidgetCodeGenerator::generatePybindContents()
+{
+  return FPCodeGenerator::generatePybindContents() + generateDataArrayPybindContents();
+}
+
 // -----------------------------------------------------------------------------
 DataArraySelectionWidgetCodeGenerator::Pointer DataArraySelectionWidgetCodeGenerator::NullPointer()
 {
@@ -116,6 +116,57 @@ QString FPCodeGenerator::getVariableType()
   return m_VariableType;
 }
 
+// -----------------------------------------------------------------------------
+QString FPCodeGenerator::getDataArrayAccessorName()
+{
+  QString name = getPropertyName();
+  if(name.endsWith("Path"))
+  {
+    name.chop(4);
+  }
+  if(!name.endsWith("Array"))
+  {
+    name.append("Array");
+  }
+  return "get" + name;
+}
+
+// -----------------------------------------------------------------------------
+QString FPCodeGenerator::generateDataArrayAccessorDeclaration()
+{
+  QString contents;
+  QTextStream ss(&contents);
+  ss << "    /**\n    * @brief Returns the DataArray at " << getPropertyName() << " without copying it. Python wraps the returned\n";
+  ss << "    * array in place, so NumPy views of it share its buffer and keep it alive.\n";
+  ss << "    * @return The array or a null pointer if it does not exist yet\n    */\n";
+  ss << "    IDataArray::Pointer " << getDataArrayAccessorName() << "() const;\n";
+  return contents;
+}
+
+// -----------------------------------------------------------------------------
+QString FPCodeGenerator::generateDataArrayAccessorDefinition()
+{
+  QString data;
+  QTextStream out(&data);
+  out << "// -----------------------------------------------------------------------------\n";
+  out << "IDataArray::Pointer @ClassName@::" << getDataArrayAccessorName() << "() const\n";
+  out << "{\n";
+  out << "  DataContainerArray::Pointer dca = getDataContainerArray();\n";
+  out << "  if(nullptr == dca)\n";
+  out << "  {\n";
+  out << "    return IDataArray::NullPointer();\n";
+  out << "  }\n";
+  out << "  return dca->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(nullptr, m_" << getPropertyName() << ");\n";
+  out << "}\n";
+  return data;
+}
+
+// -----------------------------------------------------------------------------
+QString FPCodeGenerator::generateDataArrayPybindContents()
+{
+  return QString("  PYB11_METHOD(IDataArray::Pointer " + getDataArrayAccessorName() + ")\n");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
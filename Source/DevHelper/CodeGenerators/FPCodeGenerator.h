@@ -104,6 +104,32 @@ protected:
   QString getInitValue();
   QString getVariableType();
 
+  /**
+   * @brief Returns the name of the accessor that returns the DataArray at the property's path
+   * @return
+   */
+  QString getDataArrayAccessorName();
+
+  /**
+   * @brief Generates the declaration of an accessor that returns the DataArray at the
+   * property's path. The array is returned by pointer so the Python bindings can wrap the
+   * existing buffer instead of copying it.
+   * @return
+   */
+  QString generateDataArrayAccessorDeclaration();
+
+  /**
+   * @brief Generates the definition of the DataArray accessor
+   * @return
+   */
+  QString generateDataArrayAccessorDefinition();
+
+  /**
+   * @brief Generates the binding for the DataArray accessor
+   * @return
+   */
+  QString generateDataArrayPybindContents();
+
 private:
   QString m_PropertyName;
   QString m_HumanLabel;
@@ -0,0 +1,261 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ArrayStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QtCore/QObject>
+
+#include "SIMPLView/DataArrayDispatch.h"
+
+namespace
+{
+// Each pass keeps k_Lanes independent accumulators so that consecutive iterations do not
+// depend on each other and the inner loop can be vectorized without reordering the math
+const size_t k_Lanes = 8;
+
+// The cancel flag is checked once per block
+const size_t k_BlockSize = size_t(1) << 20;
+
+/**
+ * @brief Returns true if the caller asked for the computation to stop
+ * @param cancel
+ * @return
+ */
+bool isCanceled(const std::atomic<bool>* cancel)
+{
+  return cancel != nullptr && cancel->load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Fills in the statistics of count values starting at data
+ * @param data
+ * @param count
+ * @param binCount
+ * @param cancel
+ * @param stats
+ * @return false if the computation was canceled
+ */
+template <typename T>
+bool computeStatistics(const T* data, size_t count, int binCount, const std::atomic<bool>* cancel, ArrayStatistics& stats)
+{
+  // Pass 1: NaN count, minimum, maximum and sum. Comparisons against NaN are false,
+  // so NaN values never replace a minimum or maximum.
+  double laneMin[k_Lanes];
+  double laneMax[k_Lanes];
+  double laneSum[k_Lanes];
+  size_t laneNan[k_Lanes];
+  std::fill_n(laneMin, k_Lanes, std::numeric_limits<double>::infinity());
+  std::fill_n(laneMax, k_Lanes, -std::numeric_limits<double>::infinity());
+  std::fill_n(laneSum, k_Lanes, 0.0);
+  std::fill_n(laneNan, k_Lanes, size_t(0));
+
+  for(size_t start = 0; start < count; start += k_BlockSize)
+  {
+    if(isCanceled(cancel))
+    {
+      return false;
+    }
+
+    size_t end = std::min(count, start + k_BlockSize);
+    size_t i = start;
+    for(; i + k_Lanes <= end; i += k_Lanes)
+    {
+      for(size_t l = 0; l < k_Lanes; l++)
+      {
+        double value = static_cast<double>(data[i + l]);
+        bool isNan = (value != value);
+        laneNan[l] += static_cast<size_t>(isNan);
+        laneMin[l] = value < laneMin[l] ? value : laneMin[l];
+        laneMax[l] = value > laneMax[l] ? value : laneMax[l];
+        laneSum[l] += isNan ? 0.0 : value;
+      }
+    }
+    for(; i < end; i++)
+    {
+      double value = static_cast<double>(data[i]);
+      bool isNan = (value != value);
+      laneNan[0] += static_cast<size_t>(isNan);
+      laneMin[0] = value < laneMin[0] ? value : laneMin[0];
+      laneMax[0] = value > laneMax[0] ? value : laneMax[0];
+      laneSum[0] += isNan ? 0.0 : value;
+    }
+  }
+
+  double sum = 0.0;
+  stats.min = laneMin[0];
+  stats.max = laneMax[0];
+  stats.nanCount = 0;
+  for(size_t l = 0; l < k_Lanes; l++)
+  {
+    stats.min = std::min(stats.min, laneMin[l]);
+    stats.max = std::max(stats.max, laneMax[l]);
+    stats.nanCount += laneNan[l];
+    sum += laneSum[l];
+  }
+
+  stats.valueCount = count - stats.nanCount;
+  if(stats.valueCount == 0)
+  {
+    stats.min = 0.0;
+    stats.max = 0.0;
+    return true;
+  }
+  stats.mean = sum / static_cast<double>(stats.valueCount);
+
+  // Pass 2: sum of squared deviations from the mean
+  double laneSquares[k_Lanes];
+  std::fill_n(laneSquares, k_Lanes, 0.0);
+  const double mean = stats.mean;
+  for(size_t start = 0; start < count; start += k_BlockSize)
+  {
+    if(isCanceled(cancel))
+    {
+      return false;
+    }
+
+    size_t end = std::min(count, start + k_BlockSize);
+    size_t i = start;
+    for(; i + k_Lanes <= end; i += k_Lanes)
+    {
+      for(size_t l = 0; l < k_Lanes; l++)
+      {
+        double value = static_cast<double>(data[i + l]);
+        double delta = (value != value) ? 0.0 : value - mean;
+        laneSquares[l] += delta * delta;
+      }
+    }
+    for(; i < end; i++)
+    {
+      double value = static_cast<double>(data[i]);
+      double delta = (value != value) ? 0.0 : value - mean;
+      laneSquares[0] += delta * delta;
+    }
+  }
+
+  double squares = 0.0;
+  for(size_t l = 0; l < k_Lanes; l++)
+  {
+    squares += laneSquares[l];
+  }
+  stats.stdDev = std::sqrt(squares / static_cast<double>(stats.valueCount));
+
+  // Pass 3: histogram. An infinite range cannot be binned.
+  double range = stats.max - stats.min;
+  if(binCount < 1 || !std::isfinite(range))
+  {
+    return true;
+  }
+
+  stats.histogram.fill(0, binCount);
+  const double scale = range > 0.0 ? binCount / range : 0.0;
+  const double minimum = stats.min;
+  const size_t lastBin = static_cast<size_t>(binCount - 1);
+  size_t* bins = stats.histogram.data();
+  for(size_t start = 0; start < count; start += k_BlockSize)
+  {
+    if(isCanceled(cancel))
+    {
+      return false;
+    }
+
+    size_t end = std::min(count, start + k_BlockSize);
+    for(size_t i = start; i < end; i++)
+    {
+      double value = static_cast<double>(data[i]);
+      if(value != value)
+      {
+        continue;
+      }
+      size_t bin = static_cast<size_t>((value - minimum) * scale);
+      bins[std::min(bin, lastBin)]++;
+    }
+  }
+
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayStatistics ArrayStatistics::Compute(const IDataArray::Pointer& array, int binCount, const std::atomic<bool>* cancel)
+{
+  ArrayStatistics stats;
+  if(array.get() == nullptr)
+  {
+    stats.errorMessage = QObject::tr("No array is selected.");
+    return stats;
+  }
+
+  stats.typeName = array->getTypeAsString();
+  stats.numberOfTuples = array->getNumberOfTuples();
+  stats.numberOfComponents = array->getNumberOfComponents();
+
+  // A preflight lists arrays without allocating them
+  if(!array->isAllocated() || array->getSize() == 0)
+  {
+    stats.errorMessage = QObject::tr("The array has no data. Execute the pipeline to preview its values.");
+    return stats;
+  }
+
+  bool canceled = false;
+  bool numeric = SIMPLView::DispatchNumericArray(array, [&](auto& typedArray) {
+    size_t count = typedArray.getSize();
+    auto* data = typedArray.getPointer(0);
+    if(count == 0 || data == nullptr)
+    {
+      return;
+    }
+    canceled = !computeStatistics(data, count, binCount, cancel, stats);
+  });
+
+  if(!numeric)
+  {
+    stats.errorMessage = QObject::tr("Statistics are only available for numeric arrays.");
+    return stats;
+  }
+  if(canceled)
+  {
+    stats.errorMessage = QObject::tr("The computation was canceled.");
+    return stats;
+  }
+
+  stats.valid = true;
+  return stats;
+}
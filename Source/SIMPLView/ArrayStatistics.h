@@ -0,0 +1,78 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @brief The ArrayStatistics struct holds summary statistics of every value in a numeric
+ * DataArray. Compute() reads the array in place with branch free loops that the compiler
+ * can vectorize, so it is safe to call from a worker thread on very large arrays.
+ */
+struct ArrayStatistics
+{
+  static const int k_DefaultBinCount = 64;
+
+  /**
+   * @brief Computes the statistics of array
+   * @param array
+   * @param binCount The number of histogram bins
+   * @param cancel Optional flag that aborts the computation when set
+   * @return
+   */
+  static ArrayStatistics Compute(const IDataArray::Pointer& array, int binCount = k_DefaultBinCount, const std::atomic<bool>* cancel = nullptr);
+
+  bool valid = false;
+  QString errorMessage;
+
+  QString typeName;
+  size_t numberOfTuples = 0;
+  int numberOfComponents = 0;
+
+  size_t valueCount = 0;
+  size_t nanCount = 0;
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  double stdDev = 0.0;
+
+  QVector<size_t> histogram;
+};
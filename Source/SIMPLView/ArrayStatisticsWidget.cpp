@@ -0,0 +1,334 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ArrayStatisticsWidget.h"
+
+#include <algorithm>
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtGui/QPainter>
+#include <QtWidgets/QFormLayout>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QVBoxLayout>
+
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+/**
+ * @brief Draws a histogram as a row of bars scaled to the tallest bin
+ */
+class ArrayStatisticsWidget::HistogramView : public QWidget
+{
+public:
+  explicit HistogramView(QWidget* parent = nullptr)
+  : QWidget(parent)
+  {
+    setMinimumHeight(80);
+  }
+
+  void setHistogram(const QVector<size_t>& histogram)
+  {
+    m_Histogram = histogram;
+    update();
+  }
+
+protected:
+  void paintEvent(QPaintEvent* event) override
+  {
+    Q_UNUSED(event)
+
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().base());
+    if(m_Histogram.isEmpty())
+    {
+      return;
+    }
+
+    size_t tallest = *std::max_element(m_Histogram.begin(), m_Histogram.end());
+    if(tallest == 0)
+    {
+      return;
+    }
+
+    const double barWidth = static_cast<double>(width()) / m_Histogram.size();
+    const int h = height();
+    for(int i = 0; i < m_Histogram.size(); i++)
+    {
+      int barHeight = static_cast<int>(static_cast<double>(m_Histogram[i]) / tallest * (h - 2));
+      QRectF bar(i * barWidth, h - barHeight, std::max(barWidth - 1.0, 1.0), barHeight);
+      painter.fillRect(bar, palette().highlight());
+    }
+  }
+
+private:
+  QVector<size_t> m_Histogram;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayStatisticsWidget::ArrayStatisticsWidget(QWidget* parent)
+: QWidget(parent)
+, m_Watcher(new QFutureWatcher<ArrayStatistics>(this))
+{
+  connect(m_Watcher, &QFutureWatcher<ArrayStatistics>::finished, this, &ArrayStatisticsWidget::computationFinished);
+
+  m_PathLabel = new QLabel(this);
+  m_PathLabel->setWordWrap(true);
+  m_TypeLabel = new QLabel(this);
+  m_SizeLabel = new QLabel(this);
+  m_MinLabel = new QLabel(this);
+  m_MaxLabel = new QLabel(this);
+  m_MeanLabel = new QLabel(this);
+  m_StdDevLabel = new QLabel(this);
+  m_NanLabel = new QLabel(this);
+  m_StatusLabel = new QLabel(this);
+  m_StatusLabel->setWordWrap(true);
+  m_HistogramView = new HistogramView(this);
+
+  for(QLabel* label : {m_MinLabel, m_MaxLabel, m_MeanLabel, m_StdDevLabel})
+  {
+    label->setTextInteractionFlags(Qt::TextSelectableByMouse);
+  }
+
+  QFormLayout* formLayout = new QFormLayout();
+  formLayout->addRow(tr("Array:"), m_PathLabel);
+  formLayout->addRow(tr("Type:"), m_TypeLabel);
+  formLayout->addRow(tr("Size:"), m_SizeLabel);
+  formLayout->addRow(tr("Min:"), m_MinLabel);
+  formLayout->addRow(tr("Max:"), m_MaxLabel);
+  formLayout->addRow(tr("Mean:"), m_MeanLabel);
+  formLayout->addRow(tr("Std Dev:"), m_StdDevLabel);
+  formLayout->addRow(tr("NaN Count:"), m_NanLabel);
+
+  QVBoxLayout* layout = new QVBoxLayout(this);
+  layout->setContentsMargins(4, 4, 4, 4);
+  layout->addLayout(formLayout);
+  layout->addWidget(m_HistogramView, 1);
+  layout->addWidget(m_StatusLabel);
+
+  showMessage(QString(), tr("Select an attribute array in the Data Structure to preview its statistics."));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayStatisticsWidget::~ArrayStatisticsWidget()
+{
+  if(m_Watcher->isRunning())
+  {
+    m_CancelFlag->store(true);
+    m_Watcher->waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayStatisticsWidget::setArray(const QString& arrayPath, const IDataArray::Pointer& array)
+{
+  m_DisplayedPath = arrayPath;
+  m_PendingPath.clear();
+  m_PendingArray.reset();
+
+  if(array.get() == nullptr)
+  {
+    showMessage(arrayPath, tr("Select an attribute array in the Data Structure to preview its statistics."));
+    return;
+  }
+
+  if(m_PipelineRunning)
+  {
+    showMessage(arrayPath, tr("Statistics are not available while the pipeline is running."));
+    return;
+  }
+
+  // A cached result is only used if it was computed from this exact array
+  auto iter = m_Cache.constFind(arrayPath);
+  if(iter != m_Cache.constEnd() && iter.value().array.lock() == array)
+  {
+    showStatistics(arrayPath, iter.value().statistics);
+    return;
+  }
+
+  showMessage(arrayPath, tr("Computing..."));
+
+  if(!m_Watcher->isRunning())
+  {
+    startComputation(arrayPath, array);
+    return;
+  }
+
+  // Let the running computation finish if it is for this array. Otherwise cancel it
+  // and compute this array next.
+  if(m_RunningPath == arrayPath && m_RunningArray == array && !m_CancelFlag->load())
+  {
+    return;
+  }
+  m_CancelFlag->store(true);
+  m_PendingPath = arrayPath;
+  m_PendingArray = array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayStatisticsWidget::clearCache()
+{
+  m_Generation++;
+  m_Cache.clear();
+  m_PendingPath.clear();
+  m_PendingArray.reset();
+  if(m_Watcher->isRunning())
+  {
+    m_CancelFlag->store(true);
+    m_Watcher->waitForFinished();
+  }
+
+  m_DisplayedPath.clear();
+  showMessage(QString(), tr("Select an attribute array in the Data Structure to preview its statistics."));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayStatisticsWidget::setPipelineRunning(bool running)
+{
+  m_PipelineRunning = running;
+  clearCache();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayStatisticsWidget::startComputation(const QString& arrayPath, const IDataArray::Pointer& array)
+{
+  m_RunningPath = arrayPath;
+  m_RunningArray = array;
+  m_RunningGeneration = m_Generation;
+
+  // The worker owns references to the array and the flag so neither can go away while it runs
+  std::shared_ptr<std::atomic<bool>> cancelFlag = std::make_shared<std::atomic<bool>>(false);
+  m_CancelFlag = cancelFlag;
+  m_Watcher->setFuture(QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), [array, cancelFlag] { return ArrayStatistics::Compute(array, ArrayStatistics::k_DefaultBinCount, cancelFlag.get()); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayStatisticsWidget::computationFinished()
+{
+  ArrayStatistics stats = m_Watcher->result();
+  QString path = m_RunningPath;
+  IDataArray::Pointer array = m_RunningArray;
+  m_RunningPath.clear();
+  m_RunningArray.reset();
+
+  bool canceled = m_CancelFlag->load();
+  if(!canceled && m_RunningGeneration == m_Generation && (stats.valid || !stats.errorMessage.isEmpty()))
+  {
+    CacheEntry entry;
+    entry.array = array;
+    entry.statistics = stats;
+    m_Cache.insert(path, entry);
+
+    if(path == m_DisplayedPath)
+    {
+      showStatistics(path, stats);
+    }
+  }
+
+  if(m_PendingArray.get() != nullptr && !m_PipelineRunning)
+  {
+    QString pendingPath = m_PendingPath;
+    IDataArray::Pointer pendingArray = m_PendingArray;
+    m_PendingPath.clear();
+    m_PendingArray.reset();
+    startComputation(pendingPath, pendingArray);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayStatisticsWidget::showStatistics(const QString& arrayPath, const ArrayStatistics& stats)
+{
+  if(!stats.valid)
+  {
+    showMessage(arrayPath, stats.errorMessage);
+    m_TypeLabel->setText(stats.typeName);
+    return;
+  }
+
+  m_PathLabel->setText(arrayPath);
+  m_TypeLabel->setText(stats.typeName);
+  m_SizeLabel->setText(tr("%1 tuples x %2 components").arg(stats.numberOfTuples).arg(stats.numberOfComponents));
+
+  if(stats.valueCount == 0)
+  {
+    m_MinLabel->clear();
+    m_MaxLabel->clear();
+    m_MeanLabel->clear();
+    m_StdDevLabel->clear();
+    m_NanLabel->setText(QString::number(stats.nanCount));
+    m_HistogramView->setHistogram(QVector<size_t>());
+    m_StatusLabel->setText(stats.numberOfTuples == 0 ? tr("The array has no data. Execute the pipeline to preview its values.") : tr("The array has no numeric values."));
+    return;
+  }
+
+  m_MinLabel->setText(QString::number(stats.min, 'g', 8));
+  m_MaxLabel->setText(QString::number(stats.max, 'g', 8));
+  m_MeanLabel->setText(QString::number(stats.mean, 'g', 8));
+  m_StdDevLabel->setText(QString::number(stats.stdDev, 'g', 8));
+  m_NanLabel->setText(QString::number(stats.nanCount));
+  m_HistogramView->setHistogram(stats.histogram);
+  m_StatusLabel->clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayStatisticsWidget::showMessage(const QString& arrayPath, const QString& message)
+{
+  m_PathLabel->setText(arrayPath);
+  m_TypeLabel->clear();
+  m_SizeLabel->clear();
+  m_MinLabel->clear();
+  m_MaxLabel->clear();
+  m_MeanLabel->clear();
+  m_StdDevLabel->clear();
+  m_NanLabel->clear();
+  m_HistogramView->setHistogram(QVector<size_t>());
+  m_StatusLabel->setText(message);
+}
@@ -0,0 +1,149 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QHash>
+#include <QtWidgets/QWidget>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+#include "SIMPLView/ArrayStatistics.h"
+
+class QLabel;
+
+/**
+ * @brief The ArrayStatisticsWidget class previews the statistics and histogram of the array
+ * selected in the data browser. The statistics are computed on a worker thread and cached per
+ * array path until clearCache() is called, which SIMPLView_UI does whenever a pipeline runs.
+ * Nothing is computed while a pipeline runs, because the filters may resize or free the arrays.
+ */
+class ArrayStatisticsWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  explicit ArrayStatisticsWidget(QWidget* parent = nullptr);
+  ~ArrayStatisticsWidget() override;
+
+public Q_SLOTS:
+  /**
+   * @brief Shows the statistics of array, computing them in the background if they are not cached
+   * @param arrayPath The path that is displayed and used as the cache key
+   * @param array
+   */
+  void setArray(const QString& arrayPath, const IDataArray::Pointer& array);
+
+  /**
+   * @brief Forgets every computed result. A running computation is canceled and this waits
+   * until the worker has stopped reading the array.
+   */
+  void clearCache();
+
+  /**
+   * @brief Clears the cache and refuses to compute anything until a pipeline is no longer running
+   * @param running
+   */
+  void setPipelineRunning(bool running);
+
+private:
+  class HistogramView;
+
+  struct CacheEntry
+  {
+    std::weak_ptr<IDataArray> array;
+    ArrayStatistics statistics;
+  };
+
+  QHash<QString, CacheEntry> m_Cache;
+
+  QFutureWatcher<ArrayStatistics>* m_Watcher = nullptr;
+  std::shared_ptr<std::atomic<bool>> m_CancelFlag;
+  QString m_DisplayedPath;
+  QString m_RunningPath;
+  IDataArray::Pointer m_RunningArray;
+  QString m_PendingPath;
+  IDataArray::Pointer m_PendingArray;
+  int m_Generation = 0;
+  int m_RunningGeneration = 0;
+  bool m_PipelineRunning = false;
+
+  QLabel* m_PathLabel = nullptr;
+  QLabel* m_TypeLabel = nullptr;
+  QLabel* m_SizeLabel = nullptr;
+  QLabel* m_MinLabel = nullptr;
+  QLabel* m_MaxLabel = nullptr;
+  QLabel* m_MeanLabel = nullptr;
+  QLabel* m_StdDevLabel = nullptr;
+  QLabel* m_NanLabel = nullptr;
+  QLabel* m_StatusLabel = nullptr;
+  HistogramView* m_HistogramView = nullptr;
+
+  /**
+   * @brief Starts computing the statistics of array on a worker thread
+   * @param arrayPath
+   * @param array
+   */
+  void startComputation(const QString& arrayPath, const IDataArray::Pointer& array);
+
+  /**
+   * @brief Stores the finished result and starts the pending computation, if any
+   */
+  void computationFinished();
+
+  /**
+   * @brief Shows stats in the labels and histogram
+   * @param arrayPath
+   * @param stats
+   */
+  void showStatistics(const QString& arrayPath, const ArrayStatistics& stats);
+
+  /**
+   * @brief Clears the labels and histogram and shows message instead
+   * @param arrayPath
+   * @param message
+   */
+  void showMessage(const QString& arrayPath, const QString& message);
+
+public:
+  ArrayStatisticsWidget(const ArrayStatisticsWidget&) = delete;            // Copy Constructor Not Implemented
+  ArrayStatisticsWidget(ArrayStatisticsWidget&&) = delete;                 // Move Constructor Not Implemented
+  ArrayStatisticsWidget& operator=(const ArrayStatisticsWidget&) = delete; // Copy Assignment Not Implemented
+  ArrayStatisticsWidget& operator=(ArrayStatisticsWidget&&) = delete;      // Move Assignment Not Implemented
+};
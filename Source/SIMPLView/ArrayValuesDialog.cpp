@@ -0,0 +1,311 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ArrayValuesDialog.h"
+
+#include <limits>
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QTableView>
+#include <QtWidgets/QVBoxLayout>
+
+#include "SIMPLView/ArrayValuesModel.h"
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayValuesDialog::ArrayValuesDialog(const QString& arrayPath, const IDataArray::Pointer& array, QWidget* parent)
+: QDialog(parent)
+, m_Model(new ArrayValuesModel(this))
+, m_FindWatcher(new QFutureWatcher<qint64>(this))
+{
+  setWindowTitle(tr("Array Values - %1").arg(arrayPath));
+  resize(700, 600);
+
+  m_View = new QTableView(this);
+  m_View->setModel(m_Model);
+  m_View->setSelectionMode(QAbstractItemView::SingleSelection);
+  m_View->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_View->setWordWrap(false);
+
+  // Fixed row heights keep the view from measuring every row on the page
+  m_View->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+  m_View->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+
+  m_GoToEdit = new QLineEdit(this);
+  m_GoToEdit->setPlaceholderText(tr("Tuple Index"));
+  connect(m_GoToEdit, &QLineEdit::returnPressed, this, &ArrayValuesDialog::goToTuple);
+  QPushButton* goToBtn = new QPushButton(tr("Go To"), this);
+  goToBtn->setAutoDefault(false);
+  connect(goToBtn, &QPushButton::clicked, this, &ArrayValuesDialog::goToTuple);
+
+  m_FindEdit = new QLineEdit(this);
+  m_FindEdit->setPlaceholderText(tr("Value"));
+  connect(m_FindEdit, &QLineEdit::returnPressed, this, &ArrayValuesDialog::findValue);
+  m_FindBtn = new QPushButton(tr("Find Next"), this);
+  m_FindBtn->setAutoDefault(false);
+  connect(m_FindBtn, &QPushButton::clicked, this, &ArrayValuesDialog::findValue);
+  m_CancelFindBtn = new QPushButton(tr("Cancel"), this);
+  m_CancelFindBtn->setAutoDefault(false);
+  m_CancelFindBtn->setEnabled(false);
+  connect(m_CancelFindBtn, &QPushButton::clicked, this, &ArrayValuesDialog::cancelFind);
+
+  m_PreviousPageBtn = new QPushButton(tr("Previous Page"), this);
+  m_PreviousPageBtn->setAutoDefault(false);
+  connect(m_PreviousPageBtn, &QPushButton::clicked, this, &ArrayValuesDialog::showPreviousPage);
+  m_NextPageBtn = new QPushButton(tr("Next Page"), this);
+  m_NextPageBtn->setAutoDefault(false);
+  connect(m_NextPageBtn, &QPushButton::clicked, this, &ArrayValuesDialog::showNextPage);
+
+  m_PageLabel = new QLabel(this);
+  m_StatusLabel = new QLabel(this);
+
+  connect(m_FindWatcher, &QFutureWatcher<qint64>::finished, this, &ArrayValuesDialog::findFinished);
+
+  QHBoxLayout* searchLayout = new QHBoxLayout();
+  searchLayout->addWidget(new QLabel(tr("Go To:"), this));
+  searchLayout->addWidget(m_GoToEdit);
+  searchLayout->addWidget(goToBtn);
+  searchLayout->addSpacing(12);
+  searchLayout->addWidget(new QLabel(tr("Find:"), this));
+  searchLayout->addWidget(m_FindEdit);
+  searchLayout->addWidget(m_FindBtn);
+  searchLayout->addWidget(m_CancelFindBtn);
+
+  QHBoxLayout* pageLayout = new QHBoxLayout();
+  pageLayout->addWidget(m_PreviousPageBtn);
+  pageLayout->addWidget(m_NextPageBtn);
+  pageLayout->addWidget(m_PageLabel);
+  pageLayout->addStretch();
+  pageLayout->addWidget(m_StatusLabel);
+
+  QVBoxLayout* layout = new QVBoxLayout(this);
+  layout->addLayout(searchLayout);
+  layout->addWidget(m_View, 1);
+  layout->addLayout(pageLayout);
+
+  if(!m_Model->setArray(array))
+  {
+    m_StatusLabel->setText(tr("Only numeric arrays can be inspected."));
+  }
+  updatePageControls();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayValuesDialog::~ArrayValuesDialog()
+{
+  if(m_FindWatcher->isRunning())
+  {
+    m_CancelFlag->store(true);
+    m_FindWatcher->waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::goToTuple()
+{
+  if(m_Model->getNumberOfTuples() == 0)
+  {
+    m_StatusLabel->setText(tr("The array has no tuples."));
+    return;
+  }
+
+  bool ok = false;
+  qulonglong tupleIndex = m_GoToEdit->text().trimmed().toULongLong(&ok);
+  if(!ok || tupleIndex >= m_Model->getNumberOfTuples())
+  {
+    m_StatusLabel->setText(tr("Enter a tuple index between 0 and %1.").arg(static_cast<qulonglong>(m_Model->getNumberOfTuples()) - 1));
+    return;
+  }
+
+  m_StatusLabel->clear();
+  selectValue(tupleIndex, 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::findValue()
+{
+  if(m_FindWatcher->isRunning())
+  {
+    return;
+  }
+
+  QString text = m_FindEdit->text().trimmed();
+  bool ok = false;
+  double value = text.toDouble(&ok);
+  if(text.compare("nan", Qt::CaseInsensitive) == 0)
+  {
+    value = std::numeric_limits<double>::quiet_NaN();
+    ok = true;
+  }
+  if(!ok)
+  {
+    m_StatusLabel->setText(tr("Enter a number to search for."));
+    return;
+  }
+
+  // Continue after the selected value so repeated searches step through the matches
+  size_t start = 0;
+  QModelIndex current = m_View->currentIndex();
+  if(current.isValid())
+  {
+    size_t tuple = m_Model->getPageStart() + static_cast<size_t>(current.row());
+    start = tuple * static_cast<size_t>(m_Model->columnCount()) + static_cast<size_t>(current.column()) + 1;
+  }
+
+  IDataArray::Pointer array = m_Model->getArray();
+  std::shared_ptr<std::atomic<bool>> cancelFlag = std::make_shared<std::atomic<bool>>(false);
+  m_CancelFlag = cancelFlag;
+  m_FindWatcher->setFuture(QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), [array, value, start, cancelFlag] { return ArrayValuesModel::FindValue(array, value, start, cancelFlag.get()); }));
+
+  m_FindBtn->setEnabled(false);
+  m_CancelFindBtn->setEnabled(true);
+  m_StatusLabel->setText(tr("Searching..."));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::cancelFind()
+{
+  if(m_FindWatcher->isRunning())
+  {
+    m_CancelFlag->store(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::findFinished()
+{
+  m_FindBtn->setEnabled(true);
+  m_CancelFindBtn->setEnabled(false);
+
+  if(m_CancelFlag->load())
+  {
+    m_StatusLabel->setText(tr("Search canceled."));
+    return;
+  }
+
+  qint64 element = m_FindWatcher->result();
+  if(element < 0)
+  {
+    m_StatusLabel->setText(tr("The value was not found."));
+    return;
+  }
+
+  size_t numComps = static_cast<size_t>(m_Model->columnCount());
+  size_t tuple = static_cast<size_t>(element) / numComps;
+  int component = static_cast<int>(static_cast<size_t>(element) % numComps);
+  m_StatusLabel->setText(tr("Found at tuple %1, component %2.").arg(static_cast<qulonglong>(tuple)).arg(component));
+  selectValue(tuple, component);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::showPreviousPage()
+{
+  size_t pageStart = m_Model->getPageStart();
+  if(pageStart == 0)
+  {
+    return;
+  }
+  m_Model->showTuple(pageStart - ArrayValuesModel::k_PageSize);
+  updatePageControls();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::showNextPage()
+{
+  size_t nextPageStart = m_Model->getPageStart() + ArrayValuesModel::k_PageSize;
+  if(nextPageStart >= m_Model->getNumberOfTuples())
+  {
+    return;
+  }
+  m_Model->showTuple(nextPageStart);
+  updatePageControls();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::selectValue(size_t tupleIndex, int component)
+{
+  int row = m_Model->showTuple(tupleIndex);
+  updatePageControls();
+  if(row < 0)
+  {
+    return;
+  }
+
+  QModelIndex index = m_Model->index(row, component);
+  m_View->setCurrentIndex(index);
+  m_View->scrollTo(index, QAbstractItemView::PositionAtCenter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ArrayValuesDialog::updatePageControls()
+{
+  size_t numTuples = m_Model->getNumberOfTuples();
+  size_t pageStart = m_Model->getPageStart();
+  size_t pageEnd = pageStart + static_cast<size_t>(m_Model->rowCount());
+
+  m_PreviousPageBtn->setEnabled(pageStart > 0);
+  m_NextPageBtn->setEnabled(pageEnd < numTuples);
+  if(numTuples == 0)
+  {
+    m_PageLabel->setText(tr("No tuples"));
+    return;
+  }
+  m_PageLabel->setText(tr("Tuples %1 - %2 of %3").arg(static_cast<qulonglong>(pageStart)).arg(static_cast<qulonglong>(pageEnd - 1)).arg(static_cast<qulonglong>(numTuples)));
+}
@@ -0,0 +1,127 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <QtCore/QFutureWatcher>
+#include <QtWidgets/QDialog>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+class ArrayValuesModel;
+class QLabel;
+class QLineEdit;
+class QPushButton;
+class QTableView;
+
+/**
+ * @brief The ArrayValuesDialog class lets the user page through the raw values of an array,
+ * jump to a tuple and search for a value. Searches run on a worker thread and can be canceled.
+ */
+class ArrayValuesDialog : public QDialog
+{
+  Q_OBJECT
+
+public:
+  ArrayValuesDialog(const QString& arrayPath, const IDataArray::Pointer& array, QWidget* parent = nullptr);
+  ~ArrayValuesDialog() override;
+
+protected Q_SLOTS:
+  /**
+   * @brief Shows the tuple typed into the Go To field
+   */
+  void goToTuple();
+
+  /**
+   * @brief Starts searching for the value typed into the Find field after the current cell
+   */
+  void findValue();
+
+  /**
+   * @brief Cancels a running search
+   */
+  void cancelFind();
+
+  /**
+   * @brief showPreviousPage
+   */
+  void showPreviousPage();
+
+  /**
+   * @brief showNextPage
+   */
+  void showNextPage();
+
+private:
+  ArrayValuesModel* m_Model = nullptr;
+  QTableView* m_View = nullptr;
+  QLineEdit* m_GoToEdit = nullptr;
+  QLineEdit* m_FindEdit = nullptr;
+  QPushButton* m_FindBtn = nullptr;
+  QPushButton* m_CancelFindBtn = nullptr;
+  QPushButton* m_PreviousPageBtn = nullptr;
+  QPushButton* m_NextPageBtn = nullptr;
+  QLabel* m_PageLabel = nullptr;
+  QLabel* m_StatusLabel = nullptr;
+
+  QFutureWatcher<qint64>* m_FindWatcher = nullptr;
+  std::shared_ptr<std::atomic<bool>> m_CancelFlag;
+
+  /**
+   * @brief Selects the given cell, changing the page if needed
+   * @param tupleIndex
+   * @param component
+   */
+  void selectValue(size_t tupleIndex, int component);
+
+  /**
+   * @brief Shows the result of the search
+   */
+  void findFinished();
+
+  /**
+   * @brief updatePageControls
+   */
+  void updatePageControls();
+
+public:
+  ArrayValuesDialog(const ArrayValuesDialog&) = delete;            // Copy Constructor Not Implemented
+  ArrayValuesDialog(ArrayValuesDialog&&) = delete;                 // Move Constructor Not Implemented
+  ArrayValuesDialog& operator=(const ArrayValuesDialog&) = delete; // Copy Assignment Not Implemented
+  ArrayValuesDialog& operator=(ArrayValuesDialog&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,360 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ArrayValuesModel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "SIMPLView/DataArrayDispatch.h"
+
+namespace
+{
+// The search tests k_Lanes elements at a time without branching and only looks for the
+// matching position once a group contains a hit
+const size_t k_Lanes = 16;
+
+// The cancel flag is checked once per block
+const size_t k_BlockSize = size_t(1) << 20;
+
+/**
+ * @brief Formats a single value for display
+ * @param value
+ * @return
+ */
+template <typename T>
+QString valueToString(T value)
+{
+  if constexpr(std::is_same<T, bool>::value)
+  {
+    return value ? QString("true") : QString("false");
+  }
+  else if constexpr(std::is_floating_point<T>::value)
+  {
+    return QString::number(static_cast<double>(value), 'g', std::numeric_limits<T>::max_digits10);
+  }
+  else if constexpr(std::is_signed<T>::value)
+  {
+    return QString::number(static_cast<qlonglong>(value));
+  }
+  else
+  {
+    return QString::number(static_cast<qulonglong>(value));
+  }
+}
+
+/**
+ * @brief Returns the first index in [begin, end) whose value satisfies matches
+ * @param data
+ * @param begin
+ * @param end
+ * @param matches
+ * @param cancel
+ * @return The index or -1 if there is no match or the search was canceled
+ */
+template <typename T, typename Predicate>
+qint64 findInRange(const T* data, size_t begin, size_t end, Predicate matches, const std::atomic<bool>* cancel)
+{
+  for(size_t blockStart = begin; blockStart < end; blockStart += k_BlockSize)
+  {
+    if(cancel != nullptr && cancel->load(std::memory_order_relaxed))
+    {
+      return -1;
+    }
+
+    size_t blockEnd = std::min(end, blockStart + k_BlockSize);
+    size_t i = blockStart;
+    for(; i + k_Lanes <= blockEnd; i += k_Lanes)
+    {
+      bool hit = false;
+      for(size_t l = 0; l < k_Lanes; l++)
+      {
+        hit |= matches(data[i + l]);
+      }
+      if(!hit)
+      {
+        continue;
+      }
+      for(size_t l = 0; l < k_Lanes; l++)
+      {
+        if(matches(data[i + l]))
+        {
+          return static_cast<qint64>(i + l);
+        }
+      }
+    }
+    for(; i < blockEnd; i++)
+    {
+      if(matches(data[i]))
+      {
+        return static_cast<qint64>(i);
+      }
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Searches data for value starting at start and wrapping around at the end
+ * @param data
+ * @param size
+ * @param value
+ * @param start
+ * @param cancel
+ * @return
+ */
+template <typename T>
+qint64 findValue(const T* data, size_t size, double value, size_t start, const std::atomic<bool>* cancel)
+{
+  start = std::min(start, size);
+  auto search = [&](auto matches) {
+    qint64 index = findInRange(data, start, size, matches, cancel);
+    if(index < 0)
+    {
+      index = findInRange(data, 0, start, matches, cancel);
+    }
+    return index;
+  };
+
+  if constexpr(std::is_floating_point<T>::value)
+  {
+    if(std::isnan(value))
+    {
+      return search([](T x) { return x != x; });
+    }
+    const T target = static_cast<T>(value);
+    return search([target](T x) { return x == target; });
+  }
+  else
+  {
+    // A value the type cannot hold exactly can never match
+    if(std::isnan(value) || value < static_cast<double>(std::numeric_limits<T>::lowest()) || value > static_cast<double>(std::numeric_limits<T>::max()) || std::trunc(value) != value)
+    {
+      return -1;
+    }
+    const T target = static_cast<T>(value);
+    return search([target](T x) { return x == target; });
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayValuesModel::ArrayValuesModel(QObject* parent)
+: QAbstractTableModel(parent)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayValuesModel::~ArrayValuesModel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ArrayValuesModel::rowCount(const QModelIndex& parent) const
+{
+  if(parent.isValid() || m_PageStart >= m_NumberOfTuples)
+  {
+    return 0;
+  }
+  return static_cast<int>(std::min(m_NumberOfTuples - m_PageStart, static_cast<size_t>(k_PageSize)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ArrayValuesModel::columnCount(const QModelIndex& parent) const
+{
+  if(parent.isValid())
+  {
+    return 0;
+  }
+  return m_NumberOfComponents;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ArrayValuesModel::isArrayUnchanged() const
+{
+  return m_Array.get() != nullptr && m_Array->getSize() == m_Size && (m_Size == 0 || m_Array->getVoidPointer(0) == m_Data);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant ArrayValuesModel::data(const QModelIndex& index, int role) const
+{
+  if(!index.isValid() || (role != Qt::DisplayRole && role != Qt::TextAlignmentRole))
+  {
+    return QVariant();
+  }
+
+  if(role == Qt::TextAlignmentRole)
+  {
+    return static_cast<int>(Qt::AlignRight | Qt::AlignVCenter);
+  }
+
+  if(!isArrayUnchanged())
+  {
+    return QVariant();
+  }
+
+  size_t tuple = m_PageStart + static_cast<size_t>(index.row());
+  size_t element = tuple * static_cast<size_t>(m_NumberOfComponents) + static_cast<size_t>(index.column());
+  if(element >= m_Size)
+  {
+    return QVariant();
+  }
+  return m_ValueToString(element);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant ArrayValuesModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if(role != Qt::DisplayRole)
+  {
+    return QAbstractTableModel::headerData(section, orientation, role);
+  }
+
+  // Rows are labeled with the tuple's index in the whole array, not on the page
+  if(orientation == Qt::Vertical)
+  {
+    return QString::number(static_cast<qulonglong>(m_PageStart + static_cast<size_t>(section)));
+  }
+  return tr("Comp %1").arg(section);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ArrayValuesModel::setArray(const IDataArray::Pointer& array)
+{
+  beginResetModel();
+  m_Array.reset();
+  m_Data = nullptr;
+  m_Size = 0;
+  m_NumberOfTuples = 0;
+  m_NumberOfComponents = 0;
+  m_PageStart = 0;
+  m_ValueToString = nullptr;
+
+  bool numeric = SIMPLView::DispatchNumericArray(array, [this](auto& typedArray) {
+    using ValueType = typename std::remove_const<typename std::remove_pointer<decltype(typedArray.getPointer(0))>::type>::type;
+    const ValueType* data = typedArray.getSize() > 0 ? typedArray.getPointer(0) : nullptr;
+    m_ValueToString = [data](size_t element) { return valueToString<ValueType>(data[element]); };
+    m_Data = data;
+  });
+
+  // An array that a preflight listed but did not allocate is shown without any tuples
+  if(numeric && m_Data != nullptr)
+  {
+    m_Array = array;
+    m_Size = array->getSize();
+    m_NumberOfTuples = array->getNumberOfTuples();
+    m_NumberOfComponents = array->getNumberOfComponents();
+  }
+  endResetModel();
+
+  return numeric;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer ArrayValuesModel::getArray() const
+{
+  return m_Array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ArrayValuesModel::getNumberOfTuples() const
+{
+  return m_NumberOfTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ArrayValuesModel::getPageStart() const
+{
+  return m_PageStart;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ArrayValuesModel::showTuple(size_t tupleIndex)
+{
+  if(m_NumberOfTuples == 0)
+  {
+    return -1;
+  }
+
+  tupleIndex = std::min(tupleIndex, m_NumberOfTuples - 1);
+  size_t pageStart = (tupleIndex / k_PageSize) * k_PageSize;
+  if(pageStart != m_PageStart)
+  {
+    beginResetModel();
+    m_PageStart = pageStart;
+    endResetModel();
+  }
+  return static_cast<int>(tupleIndex - m_PageStart);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 ArrayValuesModel::FindValue(const IDataArray::Pointer& array, double value, size_t start, const std::atomic<bool>* cancel)
+{
+  qint64 index = -1;
+  SIMPLView::DispatchNumericArray(array, [&](auto& typedArray) {
+    size_t size = typedArray.getSize();
+    if(size > 0 && typedArray.getPointer(0) != nullptr)
+    {
+      index = findValue(typedArray.getPointer(0), size, value, start, cancel);
+    }
+  });
+  return index;
+}
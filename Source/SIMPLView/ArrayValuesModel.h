@@ -0,0 +1,157 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include <QtCore/QAbstractTableModel>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+/**
+ * @brief The ArrayValuesModel class shows the raw values of a numeric DataArray with one row per
+ * tuple and one column per component. Qt item models are limited to int rows, so the model
+ * exposes one page of tuples at a time and the values are read straight from the array's
+ * memory when a cell is painted. Nothing is copied or converted up front.
+ */
+class ArrayValuesModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+public:
+  explicit ArrayValuesModel(QObject* parent = nullptr);
+  ~ArrayValuesModel() override;
+
+  static const int k_PageSize = 1000000;
+
+  /**
+   * @brief rowCount
+   * @param parent
+   * @return
+   */
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  /**
+   * @brief columnCount
+   * @param parent
+   * @return
+   */
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  /**
+   * @brief data
+   * @param index
+   * @param role
+   * @return
+   */
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  /**
+   * @brief headerData
+   * @param section
+   * @param orientation
+   * @param role
+   * @return
+   */
+  QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+  /**
+   * @brief Shows array, starting at the first page
+   * @param array
+   * @return false if array is null or not numeric
+   */
+  bool setArray(const IDataArray::Pointer& array);
+
+  /**
+   * @brief getArray
+   * @return
+   */
+  IDataArray::Pointer getArray() const;
+
+  /**
+   * @brief Returns the total number of tuples in the array
+   * @return
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the index of the first tuple on the current page
+   * @return
+   */
+  size_t getPageStart() const;
+
+  /**
+   * @brief Shows the page that contains tupleIndex
+   * @param tupleIndex
+   * @return The row of tupleIndex on the new page
+   */
+  int showTuple(size_t tupleIndex);
+
+  /**
+   * @brief Searches array for the first element equal to value at or after element index start,
+   * wrapping around at the end. The scan runs in blocks so that it vectorizes and can be canceled.
+   * @param array
+   * @param value
+   * @param start
+   * @param cancel
+   * @return The element index or -1 if no element matches
+   */
+  static qint64 FindValue(const IDataArray::Pointer& array, double value, size_t start, const std::atomic<bool>* cancel);
+
+private:
+  IDataArray::Pointer m_Array;
+  const void* m_Data = nullptr;
+  size_t m_Size = 0;
+  size_t m_NumberOfTuples = 0;
+  int m_NumberOfComponents = 0;
+  size_t m_PageStart = 0;
+  std::function<QString(size_t)> m_ValueToString;
+
+  /**
+   * @brief Returns false if the array was resized or reallocated since setArray() was called.
+   * This is only a consistency check for edits made between runs. It cannot protect against a
+   * running pipeline, so SIMPLView_UI closes every values dialog when a pipeline starts.
+   * @return
+   */
+  bool isArrayUnchanged() const;
+
+public:
+  ArrayValuesModel(const ArrayValuesModel&) = delete;            // Copy Constructor Not Implemented
+  ArrayValuesModel(ArrayValuesModel&&) = delete;                 // Move Constructor Not Implemented
+  ArrayValuesModel& operator=(const ArrayValuesModel&) = delete; // Copy Assignment Not Implemented
+  ArrayValuesModel& operator=(ArrayValuesModel&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,85 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+
+namespace SIMPLView
+{
+/**
+ * @brief Calls func with the DataArray<T> behind array for every numeric element type T.
+ * This is how the data browser tools reach the raw, typed values of an array without copying
+ * or converting them.
+ * @param array
+ * @param func A generic callable that accepts a DataArray<T>&
+ * @return false if array is null or does not hold a numeric type
+ */
+template <typename Func>
+bool DispatchNumericArray(const IDataArray::Pointer& array, Func&& func)
+{
+  if(array.get() == nullptr)
+  {
+    return false;
+  }
+
+#define SIMPLVIEW_DISPATCH_TYPE(Type)                                                                                                                                                                  \
+  if(std::shared_ptr<DataArray<Type>> typedArray = std::dynamic_pointer_cast<DataArray<Type>>(array))                                                                                                  \
+  {                                                                                                                                                                                                    \
+    func(*typedArray);                                                                                                                                                                                 \
+    return true;                                                                                                                                                                                       \
+  }
+
+  SIMPLVIEW_DISPATCH_TYPE(float)
+  SIMPLVIEW_DISPATCH_TYPE(double)
+  SIMPLVIEW_DISPATCH_TYPE(int8_t)
+  SIMPLVIEW_DISPATCH_TYPE(uint8_t)
+  SIMPLVIEW_DISPATCH_TYPE(int16_t)
+  SIMPLVIEW_DISPATCH_TYPE(uint16_t)
+  SIMPLVIEW_DISPATCH_TYPE(int32_t)
+  SIMPLVIEW_DISPATCH_TYPE(uint32_t)
+  SIMPLVIEW_DISPATCH_TYPE(int64_t)
+  SIMPLVIEW_DISPATCH_TYPE(uint64_t)
+  SIMPLVIEW_DISPATCH_TYPE(bool)
+
+#undef SIMPLVIEW_DISPATCH_TYPE
+
+  return false;
+}
+} // namespace SIMPLView
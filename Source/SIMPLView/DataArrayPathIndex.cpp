@@ -0,0 +1,261 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayPathIndex.h"
+
+#include <QtCore/QCryptographicHash>
+
+#include "SIMPLView/DataBrowserState.h"
+
+namespace
+{
+/**
+ * @brief Returns true if the geometry type satisfies the requirement. An empty requirement accepts anything.
+ * @param types
+ * @param type
+ * @return
+ */
+bool geometryMatches(const IGeometry::Types& types, IGeometry::Type type)
+{
+  return types.isEmpty() || types.contains(type) || types.contains(IGeometry::Type::Any);
+}
+
+/**
+ * @brief Returns true if the attribute matrix type satisfies the requirement. An empty requirement accepts anything.
+ * @param types
+ * @param type
+ * @return
+ */
+bool attributeMatrixMatches(const AttributeMatrix::Types& types, AttributeMatrix::Type type)
+{
+  return types.isEmpty() || types.contains(type) || types.contains(AttributeMatrix::Type::Any);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPathIndex::DataArrayPathIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPathIndex::~DataArrayPathIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataArrayPathIndex::update(const DataContainerArray::Pointer& dca)
+{
+  if(dca.get() == nullptr)
+  {
+    bool changed = !m_Signature.isEmpty();
+    clear();
+    return changed;
+  }
+
+  QVector<QString> names;
+  QHash<QString, DataContainerEntry> entries;
+  QCryptographicHash structureHash(QCryptographicHash::Sha1);
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    QString name = dc->getName();
+    QByteArray signature = DataBrowserState::CreateDataContainerSignature(dc);
+    structureHash.addData(signature);
+    names.push_back(name);
+
+    // Data containers that did not change keep their existing entry
+    auto iter = m_DataContainers.find(name);
+    if(iter != m_DataContainers.end() && iter.value().signature == signature)
+    {
+      entries.insert(name, std::move(iter.value()));
+    }
+    else
+    {
+      entries.insert(name, CreateEntry(dc, signature));
+    }
+  }
+
+  m_DataContainerNames = names;
+  m_DataContainers = entries;
+
+  QByteArray signature = structureHash.result();
+  bool changed = (signature != m_Signature);
+  m_Signature = signature;
+  return changed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray DataArrayPathIndex::getSignature() const
+{
+  return m_Signature;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPathIndex::DataContainerEntry DataArrayPathIndex::CreateEntry(const DataContainer::Pointer& dc, const QByteArray& signature)
+{
+  DataContainerEntry entry;
+  entry.signature = signature;
+  IGeometry::Pointer geom = dc->getGeometry();
+  if(geom.get() != nullptr)
+  {
+    entry.geometryType = geom->getGeometryType();
+  }
+
+  QHash<QString, int> bucketIndices;
+  for(const QString& amName : dc->getAttributeMatrixNames())
+  {
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+    AttributeMatrix::Type amType = am->getType();
+    entry.attributeMatrices.push_back(qMakePair(DataArrayPath(dc->getName(), amName, ""), amType));
+
+    for(const QString& arrayName : am->getAttributeArrayNames())
+    {
+      IDataArray::Pointer array = am->getAttributeArray(arrayName);
+      QString typeName = array->getTypeAsString();
+      QVector<size_t> cDims = array->getComponentDimensions();
+
+      QString bucketKey = QString("%1|%2").arg(static_cast<int>(amType)).arg(typeName);
+      for(size_t dim : cDims)
+      {
+        bucketKey += QString("|%1").arg(dim);
+      }
+
+      int bucketIndex = bucketIndices.value(bucketKey, -1);
+      if(bucketIndex < 0)
+      {
+        bucketIndex = entry.arrayBuckets.size();
+        bucketIndices.insert(bucketKey, bucketIndex);
+        ArrayBucket bucket;
+        bucket.amType = amType;
+        bucket.typeName = typeName;
+        bucket.componentDimensions = cDims;
+        entry.arrayBuckets.push_back(bucket);
+      }
+      entry.arrayBuckets[bucketIndex].paths.push_back(DataArrayPath(dc->getName(), amName, arrayName));
+    }
+  }
+
+  return entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayPathIndex::clear()
+{
+  m_DataContainerNames.clear();
+  m_DataContainers.clear();
+  m_Signature.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> DataArrayPathIndex::findDataContainers(const DataContainerSelectionFilterParameter::RequirementType& req) const
+{
+  QVector<DataArrayPath> paths;
+  for(const QString& name : m_DataContainerNames)
+  {
+    if(geometryMatches(req.dcGeometryTypes, m_DataContainers[name].geometryType))
+    {
+      paths.push_back(DataArrayPath(name, "", ""));
+    }
+  }
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> DataArrayPathIndex::findAttributeMatrices(const AttributeMatrixSelectionFilterParameter::RequirementType& req) const
+{
+  QVector<DataArrayPath> paths;
+  for(const QString& name : m_DataContainerNames)
+  {
+    const DataContainerEntry& entry = m_DataContainers[name];
+    if(!geometryMatches(req.dcGeometryTypes, entry.geometryType))
+    {
+      continue;
+    }
+
+    for(const auto& am : entry.attributeMatrices)
+    {
+      if(attributeMatrixMatches(req.amTypes, am.second))
+      {
+        paths.push_back(am.first);
+      }
+    }
+  }
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> DataArrayPathIndex::findDataArrays(const DataArraySelectionFilterParameter::RequirementType& req) const
+{
+  QVector<DataArrayPath> paths;
+  for(const QString& name : m_DataContainerNames)
+  {
+    const DataContainerEntry& entry = m_DataContainers[name];
+    if(!geometryMatches(req.dcGeometryTypes, entry.geometryType))
+    {
+      continue;
+    }
+
+    for(const ArrayBucket& bucket : entry.arrayBuckets)
+    {
+      if(!attributeMatrixMatches(req.amTypes, bucket.amType))
+      {
+        continue;
+      }
+      if(!req.daTypes.isEmpty() && !req.daTypes.contains(bucket.typeName))
+      {
+        continue;
+      }
+      if(!req.componentDimensions.isEmpty() && !req.componentDimensions.contains(bucket.componentDimensions))
+      {
+        continue;
+      }
+      paths += bucket.paths;
+    }
+  }
+  return paths;
+}
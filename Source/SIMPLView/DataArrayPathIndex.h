@@ -0,0 +1,137 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
+
+/**
+ * @brief The DataArrayPathIndex class indexes the paths of a DataContainerArray by the properties
+ * that filter parameter requirements select on. Attribute arrays are grouped into buckets that
+ * share a geometry type, attribute matrix type, primitive type and component dimensions, so
+ * matching a requirement only visits the buckets instead of every array. update() re-indexes
+ * only the data containers whose structure changed.
+ */
+class DataArrayPathIndex
+{
+public:
+  DataArrayPathIndex();
+  ~DataArrayPathIndex();
+
+  /**
+   * @brief Brings the index up to date with dca. This is the only walk over the data structure;
+   * the signature it computes tells the caller whether the data browser has to be rebuilt.
+   * @param dca
+   * @return true if the structure differs from the one indexed before
+   */
+  bool update(const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Returns a hash of the names, types and dimensions of every data container, attribute
+   * matrix and attribute array that is indexed
+   * @return The hash or an empty array if nothing is indexed
+   */
+  QByteArray getSignature() const;
+
+  /**
+   * @brief Removes every entry from the index
+   */
+  void clear();
+
+  /**
+   * @brief Returns the paths of the data containers that satisfy req
+   * @param req
+   * @return
+   */
+  QVector<DataArrayPath> findDataContainers(const DataContainerSelectionFilterParameter::RequirementType& req) const;
+
+  /**
+   * @brief Returns the paths of the attribute matrices that satisfy req
+   * @param req
+   * @return
+   */
+  QVector<DataArrayPath> findAttributeMatrices(const AttributeMatrixSelectionFilterParameter::RequirementType& req) const;
+
+  /**
+   * @brief Returns the paths of the attribute arrays that satisfy req
+   * @param req
+   * @return
+   */
+  QVector<DataArrayPath> findDataArrays(const DataArraySelectionFilterParameter::RequirementType& req) const;
+
+private:
+  struct ArrayBucket
+  {
+    AttributeMatrix::Type amType;
+    QString typeName;
+    QVector<size_t> componentDimensions;
+    QVector<DataArrayPath> paths;
+  };
+
+  struct DataContainerEntry
+  {
+    QByteArray signature;
+    IGeometry::Type geometryType = IGeometry::Type::Unknown;
+    QVector<QPair<DataArrayPath, AttributeMatrix::Type>> attributeMatrices;
+    QVector<ArrayBucket> arrayBuckets;
+  };
+
+  QVector<QString> m_DataContainerNames;
+  QHash<QString, DataContainerEntry> m_DataContainers;
+  QByteArray m_Signature;
+
+  /**
+   * @brief Builds the index entry of a single data container
+   * @param dc
+   * @param signature
+   * @return
+   */
+  static DataContainerEntry CreateEntry(const DataContainer::Pointer& dc, const QByteArray& signature);
+
+public:
+  DataArrayPathIndex(const DataArrayPathIndex&) = delete;            // Copy Constructor Not Implemented
+  DataArrayPathIndex(DataArrayPathIndex&&) = delete;                 // Move Constructor Not Implemented
+  DataArrayPathIndex& operator=(const DataArrayPathIndex&) = delete; // Copy Assignment Not Implemented
+  DataArrayPathIndex& operator=(DataArrayPathIndex&&) = delete;      // Move Assignment Not Implemented
+};
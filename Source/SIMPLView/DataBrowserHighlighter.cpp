@@ -0,0 +1,180 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataBrowserHighlighter.h"
+
+#include <QtGui/QBrush>
+#include <QtGui/QColor>
+#include <QtWidgets/QTreeView>
+
+namespace
+{
+const QString k_PathSeparator("|");
+const int k_HighlightAlpha = 70;
+
+/**
+ * @brief Returns the key of the first depth levels of path
+ * @param path
+ * @param depth
+ * @return
+ */
+QString itemKey(const DataArrayPath& path, int depth)
+{
+  QString key = path.getDataContainerName();
+  if(depth > 1)
+  {
+    key += k_PathSeparator + path.getAttributeMatrixName();
+  }
+  if(depth > 2)
+  {
+    key += k_PathSeparator + path.getDataArrayName();
+  }
+  return key;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataBrowserHighlighter::DataBrowserHighlighter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataBrowserHighlighter::~DataBrowserHighlighter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QModelIndex DataBrowserHighlighter::findItem(QTreeView* view, const DataArrayPath& path, int depth)
+{
+  QString key = itemKey(path, depth);
+  auto iter = m_Items.constFind(key);
+  if(iter != m_Items.constEnd() && iter.value().isValid())
+  {
+    return iter.value();
+  }
+
+  QModelIndex parent;
+  QString parentKey;
+  if(depth > 1)
+  {
+    parent = findItem(view, path, depth - 1);
+    if(!parent.isValid())
+    {
+      return QModelIndex();
+    }
+    parentKey = itemKey(path, depth - 1);
+  }
+
+  // The children of a parent are read once and remembered
+  if(m_VisitedParents.contains(parentKey))
+  {
+    return QModelIndex();
+  }
+  m_VisitedParents.insert(parentKey);
+
+  QAbstractItemModel* model = view->model();
+  int rowCount = model->rowCount(parent);
+  for(int row = 0; row < rowCount; row++)
+  {
+    QModelIndex child = model->index(row, 0, parent);
+    QString childKey = child.data(Qt::DisplayRole).toString();
+    if(depth > 1)
+    {
+      childKey = parentKey + k_PathSeparator + childKey;
+    }
+    m_Items.insert(childKey, QPersistentModelIndex(child));
+  }
+
+  return m_Items.value(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserHighlighter::highlight(QTreeView* view, const QVector<DataArrayPath>& paths)
+{
+  clear(view);
+  if(view == nullptr || view->model() == nullptr)
+  {
+    return;
+  }
+
+  QColor color = view->palette().color(QPalette::Highlight);
+  color.setAlpha(k_HighlightAlpha);
+  QBrush brush(color);
+
+  QAbstractItemModel* model = view->model();
+  for(const DataArrayPath& path : paths)
+  {
+    int depth = path.getDataArrayName().isEmpty() ? (path.getAttributeMatrixName().isEmpty() ? 1 : 2) : 3;
+    QModelIndex index = findItem(view, path, depth);
+    if(index.isValid())
+    {
+      model->setData(index, brush, Qt::BackgroundRole);
+      m_Highlighted.push_back(QPersistentModelIndex(index));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserHighlighter::clear(QTreeView* view)
+{
+  if(view != nullptr && view->model() != nullptr)
+  {
+    QAbstractItemModel* model = view->model();
+    for(const QPersistentModelIndex& index : m_Highlighted)
+    {
+      if(index.isValid())
+      {
+        model->setData(index, QVariant(), Qt::BackgroundRole);
+      }
+    }
+  }
+  m_Highlighted.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserHighlighter::reset()
+{
+  m_Items.clear();
+  m_VisitedParents.clear();
+  m_Highlighted.clear();
+}
@@ -0,0 +1,97 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QPersistentModelIndex>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+
+class QTreeView;
+
+/**
+ * @brief The DataBrowserHighlighter class marks the data browser items of a given set of paths.
+ * The paths come from the DataArrayPathIndex, so showing the items that match a requirement only
+ * touches those items instead of walking the whole tree. Items are looked up one level at a time
+ * and the children of each visited item are remembered until the tree is rebuilt.
+ */
+class DataBrowserHighlighter
+{
+public:
+  DataBrowserHighlighter();
+  ~DataBrowserHighlighter();
+
+  /**
+   * @brief Marks the items of paths in view and unmarks the items marked before
+   * @param view
+   * @param paths
+   */
+  void highlight(QTreeView* view, const QVector<DataArrayPath>& paths);
+
+  /**
+   * @brief Unmarks every marked item
+   * @param view
+   */
+  void clear(QTreeView* view);
+
+  /**
+   * @brief Forgets the remembered items. Call this after the tree has been rebuilt.
+   */
+  void reset();
+
+private:
+  QHash<QString, QPersistentModelIndex> m_Items;
+  QSet<QString> m_VisitedParents;
+  QVector<QPersistentModelIndex> m_Highlighted;
+
+  /**
+   * @brief Returns the item at the given level of path, or an invalid index if it is not in the tree
+   * @param view
+   * @param path
+   * @param depth 1 for the data container, 2 for the attribute matrix, 3 for the attribute array
+   * @return
+   */
+  QModelIndex findItem(QTreeView* view, const DataArrayPath& path, int depth);
+
+public:
+  DataBrowserHighlighter(const DataBrowserHighlighter&) = delete;            // Copy Constructor Not Implemented
+  DataBrowserHighlighter(DataBrowserHighlighter&&) = delete;                 // Move Constructor Not Implemented
+  DataBrowserHighlighter& operator=(const DataBrowserHighlighter&) = delete; // Copy Assignment Not Implemented
+  DataBrowserHighlighter& operator=(DataBrowserHighlighter&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,246 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataBrowserState.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QStringList>
+#include <QtWidgets/QScrollBar>
+#include <QtWidgets/QTreeView>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+namespace
+{
+const QString k_PathSeparator("|");
+
+/**
+ * @brief Returns the path of index in its model made from the display text of each level
+ * @param index
+ * @param parentPath
+ * @return
+ */
+QString itemPath(const QModelIndex& index, const QString& parentPath)
+{
+  return parentPath + k_PathSeparator + index.data(Qt::DisplayRole).toString();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataBrowserState::DataBrowserState() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataBrowserState::~DataBrowserState() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray DataBrowserState::CreateDataContainerSignature(const DataContainer::Pointer& dc)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  auto addText = [&hash](const QString& text) {
+    hash.addData(text.toUtf8());
+    hash.addData("\0", 1);
+  };
+  auto addNumber = [&hash](qulonglong value) {
+    hash.addData(QByteArray::number(value));
+    hash.addData("\0", 1);
+  };
+
+  addText(dc->getName());
+  IGeometry::Pointer geom = dc->getGeometry();
+  addText(geom.get() != nullptr ? geom->getGeometryTypeAsString() : QString());
+
+  for(const QString& amName : dc->getAttributeMatrixNames())
+  {
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+    addText(amName);
+    addNumber(static_cast<qulonglong>(am->getType()));
+    for(size_t dim : am->getTupleDimensions())
+    {
+      addNumber(dim);
+    }
+
+    for(const QString& arrayName : am->getAttributeArrayNames())
+    {
+      IDataArray::Pointer array = am->getAttributeArray(arrayName);
+      addText(arrayName);
+      addText(array->getTypeAsString());
+      addNumber(array->getNumberOfTuples());
+      for(size_t dim : array->getComponentDimensions())
+      {
+        addNumber(dim);
+      }
+    }
+  }
+
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayPath DataBrowserState::CreateDataArrayPath(const QModelIndex& index)
+{
+  QStringList names;
+  for(QModelIndex current = index; current.isValid(); current = current.parent())
+  {
+    names.push_front(current.data(Qt::DisplayRole).toString());
+  }
+
+  // Data Container / Attribute Matrix / Attribute Array
+  if(names.isEmpty() || names.size() > 3)
+  {
+    return DataArrayPath();
+  }
+  while(names.size() < 3)
+  {
+    names.push_back(QString());
+  }
+  return DataArrayPath(names[0], names[1], names[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer DataBrowserState::FindDataArray(const AbstractFilter::Pointer& filter, const DataArrayPath& path)
+{
+  if(filter.get() == nullptr || filter->getDataContainerArray().get() == nullptr)
+  {
+    return IDataArray::NullPointer();
+  }
+
+  AttributeMatrix::Pointer am = filter->getDataContainerArray()->getAttributeMatrix(path);
+  if(am.get() == nullptr)
+  {
+    return IDataArray::NullPointer();
+  }
+  return am->getAttributeArray(path.getDataArrayName());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserState::save(QTreeView* view)
+{
+  m_ExpandedPaths.clear();
+  m_CurrentPath.clear();
+  m_ScrollPosition = 0;
+  if(view == nullptr || view->model() == nullptr)
+  {
+    return;
+  }
+
+  saveExpanded(view, QModelIndex(), QString());
+
+  QModelIndex current = view->currentIndex();
+  QString currentPath;
+  while(current.isValid())
+  {
+    currentPath = k_PathSeparator + current.data(Qt::DisplayRole).toString() + currentPath;
+    current = current.parent();
+  }
+  m_CurrentPath = currentPath;
+  m_ScrollPosition = view->verticalScrollBar()->value();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserState::saveExpanded(QTreeView* view, const QModelIndex& parent, const QString& parentPath)
+{
+  // Only expanded items can have expanded children, so collapsed branches are never visited
+  QAbstractItemModel* model = view->model();
+  int rowCount = model->rowCount(parent);
+  for(int row = 0; row < rowCount; row++)
+  {
+    QModelIndex index = model->index(row, 0, parent);
+    if(!view->isExpanded(index))
+    {
+      continue;
+    }
+
+    QString path = itemPath(index, parentPath);
+    m_ExpandedPaths.insert(path);
+    saveExpanded(view, index, path);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserState::restore(QTreeView* view) const
+{
+  if(view == nullptr || view->model() == nullptr)
+  {
+    return;
+  }
+
+  if(!m_ExpandedPaths.isEmpty())
+  {
+    restoreExpanded(view, QModelIndex(), QString());
+  }
+  view->verticalScrollBar()->setValue(m_ScrollPosition);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserState::restoreExpanded(QTreeView* view, const QModelIndex& parent, const QString& parentPath) const
+{
+  QAbstractItemModel* model = view->model();
+  int rowCount = model->rowCount(parent);
+  for(int row = 0; row < rowCount; row++)
+  {
+    QModelIndex index = model->index(row, 0, parent);
+    QString path = itemPath(index, parentPath);
+    if(path == m_CurrentPath)
+    {
+      view->setCurrentIndex(index);
+    }
+
+    if(!m_ExpandedPaths.contains(path))
+    {
+      continue;
+    }
+
+    view->setExpanded(index, true);
+    restoreExpanded(view, index, path);
+  }
+}
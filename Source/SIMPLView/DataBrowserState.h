@@ -0,0 +1,123 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QModelIndex>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+class QTreeView;
+
+/**
+ * @brief The DataBrowserState class lets SIMPLView_UI avoid needless rebuilds of the data browser.
+ * CreateDataContainerSignature() summarizes the structure of a data container so unchanged
+ * structures can be skipped, and save()/restore() keep the expanded items and scroll position
+ * of the tree when it does have to be rebuilt.
+ */
+class DataBrowserState
+{
+public:
+  DataBrowserState();
+  ~DataBrowserState();
+
+  /**
+   * @brief Returns a hash of the structure of a single data container
+   * @param dc
+   * @return
+   */
+  static QByteArray CreateDataContainerSignature(const DataContainer::Pointer& dc);
+
+  /**
+   * @brief Returns the path of the data browser item at index. Only the levels that exist are
+   * filled in, so an attribute matrix item has an empty data array name.
+   * @param index
+   * @return
+   */
+  static DataArrayPath CreateDataArrayPath(const QModelIndex& index);
+
+  /**
+   * @brief Returns the attribute array at path in the filter's DataContainerArray
+   * @param filter
+   * @param path
+   * @return The array or a null pointer if it does not exist
+   */
+  static IDataArray::Pointer FindDataArray(const AbstractFilter::Pointer& filter, const DataArrayPath& path);
+
+  /**
+   * @brief Remembers which items of view are expanded and where it is scrolled to
+   * @param view
+   */
+  void save(QTreeView* view);
+
+  /**
+   * @brief Expands the items that were expanded when save() was called and scrolls back to the same position
+   * @param view
+   */
+  void restore(QTreeView* view) const;
+
+private:
+  QSet<QString> m_ExpandedPaths;
+  QString m_CurrentPath;
+  int m_ScrollPosition = 0;
+
+  /**
+   * @brief saveExpanded
+   * @param view
+   * @param parent
+   * @param parentPath
+   */
+  void saveExpanded(QTreeView* view, const QModelIndex& parent, const QString& parentPath);
+
+  /**
+   * @brief restoreExpanded
+   * @param view
+   * @param parent
+   * @param parentPath
+   */
+  void restoreExpanded(QTreeView* view, const QModelIndex& parent, const QString& parentPath) const;
+
+public:
+  DataBrowserState(const DataBrowserState&) = delete;            // Copy Constructor Not Implemented
+  DataBrowserState(DataBrowserState&&) = delete;                 // Move Constructor Not Implemented
+  DataBrowserState& operator=(const DataBrowserState&) = delete; // Copy Assignment Not Implemented
+  DataBrowserState& operator=(DataBrowserState&&) = delete;      // Move Assignment Not Implemented
+};
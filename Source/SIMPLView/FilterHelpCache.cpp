@@ -0,0 +1,234 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FilterHelpCache.h"
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QObject>
+
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/IFilterFactory.hpp"
+
+#ifdef SIMPL_USE_MKDOCS
+#define URL_GENERATOR QtSDocServer
+#include "SVWidgetsLib/QtSupport/QtSDocServer.h"
+#endif
+
+#ifdef SIMPL_USE_DISCOUNT
+#define URL_GENERATOR QtSHelpUrlGenerator
+#include "SVWidgetsLib/QtSupport/QtSHelpUrlGenerator.h"
+#endif
+
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+namespace
+{
+// Help pages compress to a few KB each; this keeps well over a thousand of them
+const qint64 k_MaxCompressedSize = 32 * 1024 * 1024;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterHelpCache::FilterHelpCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterHelpCache::~FilterHelpCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUrl FilterHelpCache::FilterHelpUrl(const QString& className)
+{
+#if(defined(SIMPL_USE_MKDOCS) || defined(SIMPL_USE_DISCOUNT))
+  return URL_GENERATOR::GenerateHTMLUrl(className);
+#else
+  Q_UNUSED(className)
+  return QUrl();
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString FilterHelpCache::FallbackHtml(const QString& className)
+{
+  IFilterFactory::Pointer factory = FilterManager::Instance()->getFactoryFromClassName(className);
+  if(factory == nullptr)
+  {
+    return QObject::tr("<h1>%1</h1><p>No documentation is available for this filter.</p>").arg(className.toHtmlEscaped());
+  }
+
+  QString html;
+  html += QString("<h1>%1</h1>").arg(factory->getFilterHumanLabel().toHtmlEscaped());
+  html += QString("<p><b>%1</b> (%2)</p>").arg(factory->getFilterGroup().toHtmlEscaped(), factory->getFilterSubGroup().toHtmlEscaped());
+  html += QObject::tr("<p>The help page for this filter could not be found. Its parameters are listed below.</p>");
+
+  AbstractFilter::Pointer filter = factory->create();
+  if(filter != nullptr)
+  {
+    html += "<table border=\"1\" cellpadding=\"4\" cellspacing=\"0\">";
+    html += QObject::tr("<tr><th>Parameter</th><th>Property</th></tr>");
+    for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+    {
+      html += QString("<tr><td>%1</td><td>%2</td></tr>").arg(parameter->getHumanLabel().toHtmlEscaped(), parameter->getPropertyName().toHtmlEscaped());
+    }
+    html += "</table>";
+  }
+
+  return html;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterHelpCache::isCached(const QString& filePath, qint64 size, const QDateTime& lastModified) const
+{
+  auto iter = m_Entries.constFind(filePath);
+  return iter != m_Entries.constEnd() && iter.value().size == size && iter.value().lastModified == lastModified;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterHelpCache::getHtml(const QUrl& url, QString& html)
+{
+  if(!url.isLocalFile())
+  {
+    return false;
+  }
+
+  QString filePath = url.toLocalFile();
+  QFileInfo fi(filePath);
+  if(!fi.isFile())
+  {
+    return false;
+  }
+  qint64 size = fi.size();
+  QDateTime lastModified = fi.lastModified();
+
+  {
+    QMutexLocker locker(&m_Mutex);
+    if(isCached(filePath, size, lastModified))
+    {
+      html = QString::fromUtf8(qUncompress(m_Entries[filePath].compressed));
+      return true;
+    }
+  }
+
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  QByteArray contents = file.readAll();
+  html = QString::fromUtf8(contents);
+
+  Entry entry;
+  entry.size = size;
+  entry.lastModified = lastModified;
+  entry.compressed = qCompress(contents);
+
+  QMutexLocker locker(&m_Mutex);
+  if(m_CompressedSize + entry.compressed.size() > k_MaxCompressedSize)
+  {
+    m_Entries.clear();
+    m_CompressedSize = 0;
+  }
+  m_CompressedSize -= m_Entries.value(filePath).compressed.size();
+  m_CompressedSize += entry.compressed.size();
+  m_Entries.insert(filePath, entry);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterHelpCache::prefetch(const QList<QUrl>& urls)
+{
+  QList<QUrl> localUrls;
+  for(const QUrl& url : urls)
+  {
+    if(url.isLocalFile())
+    {
+      localUrls.push_back(url);
+    }
+  }
+  if(localUrls.isEmpty())
+  {
+    return;
+  }
+
+  // The task keeps the cache alive even if the application lets go of it first
+  std::shared_ptr<FilterHelpCache> self = shared_from_this();
+  QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), [self, localUrls] {
+    QString html;
+    for(const QUrl& url : localUrls)
+    {
+      self->getHtml(url, html);
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterHelpCache::prefetchAllFilters()
+{
+  QList<QUrl> urls;
+  FilterManager::Collection factories = FilterManager::Instance()->getFactories();
+  for(auto iter = factories.constBegin(); iter != factories.constEnd(); ++iter)
+  {
+    urls.push_back(FilterHelpUrl(iter.key()));
+  }
+  prefetch(urls);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterHelpCache::clear()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Entries.clear();
+  m_CompressedSize = 0;
+}
@@ -0,0 +1,126 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QDateTime>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QUrl>
+
+/**
+ * @brief The FilterHelpCache class keeps the rendered HTML help pages in memory, compressed, so
+ * the embedded help viewer can show them without touching the disk. Pages are identified by
+ * file path, size and modification time, so rebuilt documentation is picked up automatically.
+ * Pages can be prefetched on the application thread pool.
+ */
+class FilterHelpCache : public std::enable_shared_from_this<FilterHelpCache>
+{
+public:
+  FilterHelpCache();
+  ~FilterHelpCache();
+
+  /**
+   * @brief Returns the URL of the filter's help page, or an empty URL if this build has no
+   * documentation
+   * @param className
+   * @return
+   */
+  static QUrl FilterHelpUrl(const QString& className);
+
+  /**
+   * @brief Builds a basic help page from the filter's factory and parameters. It is shown when
+   * the filter has no help page.
+   * @param className
+   * @return
+   */
+  static QString FallbackHtml(const QString& className);
+
+  /**
+   * @brief Returns the page at a local file URL, reading and caching it if needed
+   * @param url
+   * @param html
+   * @return false if the URL is not a readable local file
+   */
+  bool getHtml(const QUrl& url, QString& html);
+
+  /**
+   * @brief Reads the given pages into the cache on a worker thread
+   * @param urls
+   */
+  void prefetch(const QList<QUrl>& urls);
+
+  /**
+   * @brief Prefetches the help page of every registered filter
+   */
+  void prefetchAllFilters();
+
+  /**
+   * @brief Removes every cached page
+   */
+  void clear();
+
+private:
+  struct Entry
+  {
+    qint64 size = 0;
+    QDateTime lastModified;
+    QByteArray compressed;
+  };
+
+  mutable QMutex m_Mutex;
+  QHash<QString, Entry> m_Entries;
+  qint64 m_CompressedSize = 0;
+
+  /**
+   * @brief Returns true if the page is cached and the file did not change since
+   * @param filePath
+   * @param size
+   * @param lastModified
+   * @return
+   */
+  bool isCached(const QString& filePath, qint64 size, const QDateTime& lastModified) const;
+
+public:
+  FilterHelpCache(const FilterHelpCache&) = delete;            // Copy Constructor Not Implemented
+  FilterHelpCache(FilterHelpCache&&) = delete;                 // Move Constructor Not Implemented
+  FilterHelpCache& operator=(const FilterHelpCache&) = delete; // Copy Assignment Not Implemented
+  FilterHelpCache& operator=(FilterHelpCache&&) = delete;      // Move Assignment Not Implemented
+};
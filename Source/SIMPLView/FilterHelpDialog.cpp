@@ -0,0 +1,136 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FilterHelpDialog.h"
+
+#include <QtGui/QTextDocument>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QTextBrowser>
+#include <QtWidgets/QVBoxLayout>
+
+#include "SIMPLView/FilterHelpCache.h"
+
+namespace
+{
+/**
+ * @brief Loads HTML pages through the FilterHelpCache. Images and style sheets are small and
+ * go through the default loader.
+ */
+class CachedTextBrowser : public QTextBrowser
+{
+public:
+  CachedTextBrowser(FilterHelpCache* cache, QWidget* parent)
+  : QTextBrowser(parent)
+  , m_Cache(cache)
+  {
+  }
+
+  QVariant loadResource(int type, const QUrl& name) override
+  {
+    if(type == QTextDocument::HtmlResource)
+    {
+      QString html;
+      if(m_Cache->getHtml(name, html))
+      {
+        return html;
+      }
+    }
+    return QTextBrowser::loadResource(type, name);
+  }
+
+private:
+  FilterHelpCache* m_Cache = nullptr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterHelpDialog::FilterHelpDialog(FilterHelpCache* cache, QWidget* parent)
+: QDialog(parent)
+{
+  setWindowTitle(tr("Filter Help"));
+  resize(800, 700);
+
+  m_Browser = new CachedTextBrowser(cache, this);
+  m_Browser->setOpenExternalLinks(true);
+
+  QPushButton* backBtn = new QPushButton(tr("Back"), this);
+  backBtn->setAutoDefault(false);
+  backBtn->setEnabled(false);
+  connect(backBtn, &QPushButton::clicked, m_Browser, &QTextBrowser::backward);
+  connect(m_Browser, &QTextBrowser::backwardAvailable, backBtn, &QPushButton::setEnabled);
+
+  QPushButton* forwardBtn = new QPushButton(tr("Forward"), this);
+  forwardBtn->setAutoDefault(false);
+  forwardBtn->setEnabled(false);
+  connect(forwardBtn, &QPushButton::clicked, m_Browser, &QTextBrowser::forward);
+  connect(m_Browser, &QTextBrowser::forwardAvailable, forwardBtn, &QPushButton::setEnabled);
+
+  connect(m_Browser, &QTextBrowser::sourceChanged, [=] { setWindowTitle(tr("Filter Help - %1").arg(m_Browser->documentTitle())); });
+
+  QHBoxLayout* buttonLayout = new QHBoxLayout();
+  buttonLayout->addWidget(backBtn);
+  buttonLayout->addWidget(forwardBtn);
+  buttonLayout->addStretch();
+
+  QVBoxLayout* layout = new QVBoxLayout(this);
+  layout->addLayout(buttonLayout);
+  layout->addWidget(m_Browser, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterHelpDialog::~FilterHelpDialog() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterHelpDialog::showUrl(const QUrl& url)
+{
+  m_Browser->setSource(url);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterHelpDialog::showHtml(const QString& title, const QString& html)
+{
+  m_Browser->clearHistory();
+  m_Browser->setHtml(html);
+  setWindowTitle(tr("Filter Help - %1").arg(title));
+}
@@ -0,0 +1,78 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QUrl>
+#include <QtWidgets/QDialog>
+
+class FilterHelpCache;
+class QTextBrowser;
+
+/**
+ * @brief The FilterHelpDialog class shows filter help pages inside SIMPLView. Pages are served
+ * from the FilterHelpCache, so once a page has been read it comes up without disk access.
+ * Links to other help pages stay inside the viewer; links to web sites open in the browser.
+ */
+class FilterHelpDialog : public QDialog
+{
+  Q_OBJECT
+
+public:
+  FilterHelpDialog(FilterHelpCache* cache, QWidget* parent = nullptr);
+  ~FilterHelpDialog() override;
+
+  /**
+   * @brief Shows the page at a local file URL
+   * @param url
+   */
+  void showUrl(const QUrl& url);
+
+  /**
+   * @brief Shows generated HTML, e.g. for a filter without a help page
+   * @param title
+   * @param html
+   */
+  void showHtml(const QString& title, const QString& html);
+
+private:
+  QTextBrowser* m_Browser = nullptr;
+
+public:
+  FilterHelpDialog(const FilterHelpDialog&) = delete;            // Copy Constructor Not Implemented
+  FilterHelpDialog(FilterHelpDialog&&) = delete;                 // Move Constructor Not Implemented
+  FilterHelpDialog& operator=(const FilterHelpDialog&) = delete; // Copy Assignment Not Implemented
+  FilterHelpDialog& operator=(FilterHelpDialog&&) = delete;      // Move Assignment Not Implemented
+};
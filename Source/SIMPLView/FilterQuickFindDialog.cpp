@@ -0,0 +1,147 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FilterQuickFindDialog.h"
+
+#include <QtGui/QKeyEvent>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QListWidget>
+#include <QtWidgets/QVBoxLayout>
+
+#include "SIMPLView/FilterSearchIndex.h"
+
+namespace
+{
+const int k_MaxResults = 30;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterQuickFindDialog::FilterQuickFindDialog(FilterSearchIndex* index, QWidget* parent)
+: QDialog(parent)
+, m_Index(index)
+{
+  setWindowTitle(tr("Quick Add Filter"));
+  resize(500, 400);
+
+  m_SearchEdit = new QLineEdit(this);
+  m_SearchEdit->setPlaceholderText(tr("Filter name, group or parameter"));
+  m_SearchEdit->installEventFilter(this);
+  connect(m_SearchEdit, &QLineEdit::textChanged, this, &FilterQuickFindDialog::updateResults);
+  connect(m_SearchEdit, &QLineEdit::returnPressed, this, &FilterQuickFindDialog::acceptCurrentItem);
+
+  m_ResultsList = new QListWidget(this);
+  m_ResultsList->setUniformItemSizes(true);
+  connect(m_ResultsList, &QListWidget::itemActivated, this, &FilterQuickFindDialog::acceptCurrentItem);
+
+  QVBoxLayout* layout = new QVBoxLayout(this);
+  layout->addWidget(m_SearchEdit);
+  layout->addWidget(m_ResultsList, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterQuickFindDialog::~FilterQuickFindDialog() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterQuickFindDialog::showEvent(QShowEvent* event)
+{
+  QDialog::showEvent(event);
+  m_SearchEdit->clear();
+  m_SearchEdit->setFocus();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterQuickFindDialog::eventFilter(QObject* watched, QEvent* event)
+{
+  if(watched == m_SearchEdit && event->type() == QEvent::KeyPress)
+  {
+    QKeyEvent* keyEvent = static_cast<QKeyEvent*>(event);
+    int row = m_ResultsList->currentRow();
+    if(keyEvent->key() == Qt::Key_Down && row + 1 < m_ResultsList->count())
+    {
+      m_ResultsList->setCurrentRow(row + 1);
+      return true;
+    }
+    if(keyEvent->key() == Qt::Key_Up && row > 0)
+    {
+      m_ResultsList->setCurrentRow(row - 1);
+      return true;
+    }
+  }
+
+  return QDialog::eventFilter(watched, event);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterQuickFindDialog::updateResults()
+{
+  m_ResultsList->clear();
+
+  for(const FilterSearchIndex::Match& match : m_Index->find(m_SearchEdit->text(), k_MaxResults))
+  {
+    QListWidgetItem* item = new QListWidgetItem(QString("%1  (%2 / %3)").arg(match.humanLabel, match.group, match.subGroup), m_ResultsList);
+    item->setData(Qt::UserRole, match.className);
+    item->setToolTip(match.className);
+  }
+
+  if(m_ResultsList->count() > 0)
+  {
+    m_ResultsList->setCurrentRow(0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterQuickFindDialog::acceptCurrentItem()
+{
+  QListWidgetItem* item = m_ResultsList->currentItem();
+  if(item == nullptr)
+  {
+    return;
+  }
+
+  Q_EMIT filterSelected(item->data(Qt::UserRole).toString());
+  accept();
+}
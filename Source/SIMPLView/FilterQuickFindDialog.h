@@ -0,0 +1,100 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QDialog>
+
+class FilterSearchIndex;
+class QLineEdit;
+class QListWidget;
+class QListWidgetItem;
+
+/**
+ * @brief The FilterQuickFindDialog class is a small popup that finds a filter by typing part of
+ * its name, a misspelling of it or one of its parameters, and adds it to the pipeline.
+ */
+class FilterQuickFindDialog : public QDialog
+{
+  Q_OBJECT
+
+public:
+  FilterQuickFindDialog(FilterSearchIndex* index, QWidget* parent = nullptr);
+  ~FilterQuickFindDialog() override;
+
+Q_SIGNALS:
+  /**
+   * @brief Emitted when the user picks a filter
+   * @param className
+   */
+  void filterSelected(const QString& className);
+
+protected:
+  /**
+   * @brief Moves the selection with the arrow keys while the search field has focus
+   * @param watched
+   * @param event
+   * @return
+   */
+  bool eventFilter(QObject* watched, QEvent* event) override;
+
+  /**
+   * @brief Clears the previous search each time the dialog is shown
+   * @param event
+   */
+  void showEvent(QShowEvent* event) override;
+
+protected Q_SLOTS:
+  /**
+   * @brief Shows the filters that match the search text
+   */
+  void updateResults();
+
+  /**
+   * @brief Emits filterSelected for the current item and closes the dialog
+   */
+  void acceptCurrentItem();
+
+private:
+  FilterSearchIndex* m_Index = nullptr;
+  QLineEdit* m_SearchEdit = nullptr;
+  QListWidget* m_ResultsList = nullptr;
+
+public:
+  FilterQuickFindDialog(const FilterQuickFindDialog&) = delete;            // Copy Constructor Not Implemented
+  FilterQuickFindDialog(FilterQuickFindDialog&&) = delete;                 // Move Constructor Not Implemented
+  FilterQuickFindDialog& operator=(const FilterQuickFindDialog&) = delete; // Copy Assignment Not Implemented
+  FilterQuickFindDialog& operator=(FilterQuickFindDialog&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,319 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FilterSearchIndex.h"
+
+#include <algorithm>
+
+#include <QtCore/QSet>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/IFilterFactory.hpp"
+
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+namespace
+{
+// How much a shared trigram counts, by field
+const float k_FieldWeights[] = {1.0f, 0.8f, 0.5f, 0.3f};
+// Bonuses for a query that appears verbatim in the human label
+const float k_PrefixBonus = 1.0f;
+const float k_SubstringBonus = 0.5f;
+// Matches must share at least this fraction of the query's weighted trigrams
+const float k_MinimumScore = 0.3f;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterSearchIndex::FilterSearchIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterSearchIndex::~FilterSearchIndex()
+{
+  if(m_UpdatePending)
+  {
+    m_Update.waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterSearchIndex::invalidate()
+{
+  // The worker only sees this copy, so the FilterManager may change while it runs. The copy also
+  // keeps the factories alive until their filters have been read.
+  FilterManager::Collection factories = FilterManager::Instance()->getFactories();
+  Snapshot previous = m_Snapshot;
+  m_Update = QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), [factories, previous] { return Build(factories, previous); });
+  m_UpdatePending = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterSearchIndex::adoptUpdate(bool wait)
+{
+  if(!m_UpdatePending || (!wait && !m_Update.isFinished()))
+  {
+    return;
+  }
+
+  m_Snapshot = m_Update.result();
+  m_UpdatePending = false;
+  m_Built = true;
+  m_Scores.resize(m_Snapshot.documents.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FilterSearchIndex::size() const
+{
+  return m_Snapshot.documents.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<quint64> FilterSearchIndex::Trigrams(const QString& text)
+{
+  QSet<quint64> trigrams;
+  QString word;
+  QString lowerText = text.toLower();
+  for(int i = 0; i <= lowerText.size(); i++)
+  {
+    if(i < lowerText.size() && lowerText[i].isLetterOrNumber())
+    {
+      word.append(lowerText[i]);
+      continue;
+    }
+    if(word.isEmpty())
+    {
+      continue;
+    }
+
+    QString padded = "  " + word + " ";
+    for(int j = 0; j + 2 < padded.size(); j++)
+    {
+      quint64 trigram = (static_cast<quint64>(padded[j].unicode()) << 32) | (static_cast<quint64>(padded[j + 1].unicode()) << 16) | static_cast<quint64>(padded[j + 2].unicode());
+      trigrams.insert(trigram);
+    }
+    word.clear();
+  }
+
+  QVector<quint64> result;
+  result.reserve(trigrams.size());
+  for(quint64 trigram : trigrams)
+  {
+    result.push_back(trigram);
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterSearchIndex::Snapshot FilterSearchIndex::Build(const FilterManager::Collection& factories, const Snapshot& previous)
+{
+  Snapshot snapshot;
+  snapshot.documents.reserve(factories.size());
+
+  for(auto iter = factories.constBegin(); iter != factories.constEnd(); ++iter)
+  {
+    IFilterFactory::Pointer factory = iter.value();
+    if(factory == nullptr)
+    {
+      continue;
+    }
+
+    // A factory that was replaced, e.g. by reloading a Python filter, is read again even though
+    // its class name did not change
+    auto previousIndex = previous.documentIndices.constFind(iter.key());
+    if(previousIndex != previous.documentIndices.constEnd() && previous.documents[previousIndex.value()].factory.lock() == factory)
+    {
+      snapshot.documentIndices.insert(iter.key(), snapshot.documents.size());
+      snapshot.documents.push_back(previous.documents[previousIndex.value()]);
+      continue;
+    }
+
+    Document document;
+    document.factory = factory;
+    document.className = factory->getFilterClassName();
+    document.humanLabel = factory->getFilterHumanLabel();
+    document.group = factory->getFilterGroup();
+    document.subGroup = factory->getFilterSubGroup();
+    document.fields[HumanLabelField] = document.humanLabel;
+    document.fields[ClassNameField] = document.className;
+    document.fields[GroupField] = document.group + " " + document.subGroup;
+
+    QStringList parameterNames;
+    AbstractFilter::Pointer filter = factory->create();
+    if(filter != nullptr)
+    {
+      for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+      {
+        parameterNames.push_back(parameter->getHumanLabel());
+        parameterNames.push_back(parameter->getPropertyName());
+      }
+    }
+    document.fields[ParameterField] = parameterNames.join(' ');
+
+    snapshot.documentIndices.insert(iter.key(), snapshot.documents.size());
+    snapshot.documents.push_back(document);
+  }
+
+  for(int i = 0; i < snapshot.documents.size(); i++)
+  {
+    AddPostings(snapshot, i);
+  }
+  return snapshot;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterSearchIndex::AddPostings(Snapshot& snapshot, int documentIndex)
+{
+  // A trigram is posted once per document, for the most important field it appears in
+  QSet<quint64> seen;
+  const Document& document = snapshot.documents[documentIndex];
+  for(int field = 0; field < FieldCount; field++)
+  {
+    for(quint64 trigram : Trigrams(document.fields[field]))
+    {
+      if(seen.contains(trigram))
+      {
+        continue;
+      }
+      seen.insert(trigram);
+
+      Posting posting;
+      posting.document = documentIndex;
+      posting.field = field;
+      snapshot.postings[trigram].push_back(posting);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<FilterSearchIndex::Match> FilterSearchIndex::find(const QString& text, int maxResults)
+{
+  // Only the very first query waits for the index; later ones use the previous index until the
+  // update has finished
+  if(!m_Built && !m_UpdatePending)
+  {
+    invalidate();
+  }
+  adoptUpdate(!m_Built);
+
+  QVector<Match> matches;
+  QString query = text.trimmed();
+  QVector<quint64> trigrams = Trigrams(query);
+  if(trigrams.isEmpty())
+  {
+    return matches;
+  }
+
+  std::fill(m_Scores.begin(), m_Scores.end(), 0.0f);
+  QVector<int> candidates;
+  for(quint64 trigram : trigrams)
+  {
+    auto iter = m_Snapshot.postings.constFind(trigram);
+    if(iter == m_Snapshot.postings.constEnd())
+    {
+      continue;
+    }
+    for(const Posting& posting : iter.value())
+    {
+      if(m_Scores[posting.document] == 0.0f)
+      {
+        candidates.push_back(posting.document);
+      }
+      m_Scores[posting.document] += k_FieldWeights[posting.field];
+    }
+  }
+
+  float trigramCount = static_cast<float>(trigrams.size());
+  for(int documentIndex : candidates)
+  {
+    float score = m_Scores[documentIndex] / trigramCount;
+    if(score < k_MinimumScore)
+    {
+      continue;
+    }
+
+    const Document& document = m_Snapshot.documents[documentIndex];
+    if(document.humanLabel.startsWith(query, Qt::CaseInsensitive))
+    {
+      score += k_PrefixBonus;
+    }
+    else if(document.humanLabel.contains(query, Qt::CaseInsensitive))
+    {
+      score += k_SubstringBonus;
+    }
+
+    Match match;
+    match.className = document.className;
+    match.humanLabel = document.humanLabel;
+    match.group = document.group;
+    match.subGroup = document.subGroup;
+    match.score = score;
+    matches.push_back(match);
+  }
+
+  std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+    if(a.score != b.score)
+    {
+      return a.score > b.score;
+    }
+    return a.humanLabel.compare(b.humanLabel, Qt::CaseInsensitive) < 0;
+  });
+  if(maxResults > 0 && matches.size() > maxResults)
+  {
+    matches.resize(maxResults);
+  }
+
+  return matches;
+}
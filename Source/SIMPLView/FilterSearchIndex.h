@@ -0,0 +1,173 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QFuture>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Filtering/FilterManager.h"
+
+/**
+ * @brief The FilterSearchIndex class is a trigram index over every registered filter factory.
+ * Each filter is indexed by its human label, class name, group, subgroup and the labels and
+ * property names of its filter parameters. Queries are matched by the trigrams they share with
+ * those fields, so misspelled or partial names still find the filter, and results are ranked
+ * by how well and where they match. The index is rebuilt on the application thread pool whenever
+ * the filter factories change. Only factories that were added or replaced are read again,
+ * because reading the parameters means creating a filter. Queries never wait for a rebuild,
+ * except the very first one. One index is shared by every SIMPLView_UI window.
+ */
+class FilterSearchIndex
+{
+public:
+  /**
+   * @brief A filter that matched a query
+   */
+  struct Match
+  {
+    QString className;
+    QString humanLabel;
+    QString group;
+    QString subGroup;
+    float score = 0.0f;
+  };
+
+  FilterSearchIndex();
+  ~FilterSearchIndex();
+
+  /**
+   * @brief Takes a snapshot of the FilterManager's factories and starts updating the index from
+   * it in the background. Must be called on the thread that owns the FilterManager.
+   */
+  void invalidate();
+
+  /**
+   * @brief Returns the best matches for the query, best first
+   * @param text
+   * @param maxResults
+   * @return
+   */
+  QVector<Match> find(const QString& text, int maxResults = 50);
+
+  /**
+   * @brief Returns the number of indexed filters
+   * @return
+   */
+  int size() const;
+
+private:
+  /**
+   * @brief The fields of a filter, in decreasing order of importance
+   */
+  enum Field
+  {
+    HumanLabelField = 0,
+    ClassNameField,
+    GroupField,
+    ParameterField,
+    FieldCount
+  };
+
+  struct Document
+  {
+    std::weak_ptr<IFilterFactory> factory;
+    QString className;
+    QString humanLabel;
+    QString group;
+    QString subGroup;
+    QString fields[FieldCount];
+  };
+
+  struct Posting
+  {
+    int document = 0;
+    int field = 0;
+  };
+
+  struct Snapshot
+  {
+    QVector<Document> documents;
+    QHash<QString, int> documentIndices;
+    QHash<quint64, QVector<Posting>> postings;
+  };
+
+  Snapshot m_Snapshot;
+  QFuture<Snapshot> m_Update;
+  bool m_UpdatePending = false;
+  bool m_Built = false;
+  QVector<float> m_Scores;
+
+  /**
+   * @brief Indexes the factories. Documents of factories that are unchanged since previous are
+   * reused; the others are read by creating a filter. May be called from any thread.
+   * @param factories
+   * @param previous
+   * @return
+   */
+  static Snapshot Build(const FilterManager::Collection& factories, const Snapshot& previous);
+
+  /**
+   * @brief Adds the postings of one document
+   * @param snapshot
+   * @param documentIndex
+   */
+  static void AddPostings(Snapshot& snapshot, int documentIndex);
+
+  /**
+   * @brief Starts using the result of the background update once it is available
+   * @param wait Block until the update has finished
+   */
+  void adoptUpdate(bool wait);
+
+  /**
+   * @brief Returns the distinct trigrams of the text. Words are padded so that the start and
+   * end of a word form trigrams of their own and short queries still match.
+   * @param text
+   * @return
+   */
+  static QVector<quint64> Trigrams(const QString& text);
+
+public:
+  FilterSearchIndex(const FilterSearchIndex&) = delete;            // Copy Constructor Not Implemented
+  FilterSearchIndex(FilterSearchIndex&&) = delete;                 // Move Constructor Not Implemented
+  FilterSearchIndex& operator=(const FilterSearchIndex&) = delete; // Copy Assignment Not Implemented
+  FilterSearchIndex& operator=(FilterSearchIndex&&) = delete;      // Move Assignment Not Implemented
+};
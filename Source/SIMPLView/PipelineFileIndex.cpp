@@ -0,0 +1,372 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineFileIndex.h"
+
+#include <algorithm>
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QObject>
+
+#include "SIMPLView/PipelineFileLoader.h"
+
+namespace
+{
+const QString k_PipelineBuilderKey("PipelineBuilder");
+const QString k_PipelineNameKey("Name");
+const QString k_FilterHumanLabelKey("Filter_Human_Label");
+const QString k_FilterNameKey("Filter_Name");
+const QString k_FilterKeyPrefix("Filter_");
+const int k_MaxValueDepth = 4;
+const int k_MaxReasons = 3;
+
+QMutex s_CacheMutex;
+QHash<QString, PipelineFileIndex::Entry> s_EntryCache;
+
+/**
+ * @brief Collects every string and number held by a filter parameter
+ * @param value
+ * @param depth
+ * @param values
+ */
+void CollectValues(const QJsonValue& value, int depth, QStringList& values)
+{
+  if(depth > k_MaxValueDepth)
+  {
+    return;
+  }
+
+  switch(value.type())
+  {
+  case QJsonValue::String:
+  {
+    QString text = value.toString();
+    if(!text.isEmpty())
+    {
+      values.push_back(text);
+    }
+    break;
+  }
+  case QJsonValue::Double:
+    values.push_back(QString::number(value.toDouble()));
+    break;
+  case QJsonValue::Array:
+    for(const QJsonValue& element : value.toArray())
+    {
+      CollectValues(element, depth + 1, values);
+    }
+    break;
+  case QJsonValue::Object:
+  {
+    QJsonObject object = value.toObject();
+    for(auto iter = object.constBegin(); iter != object.constEnd(); ++iter)
+    {
+      CollectValues(iter.value(), depth + 1, values);
+    }
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief Adds a reason to the match unless it already has enough of them
+ * @param match
+ * @param reason
+ */
+void AddReason(PipelineFileIndex::Match& match, const QString& reason)
+{
+  if(match.reasons.size() < k_MaxReasons && !match.reasons.contains(reason))
+  {
+    match.reasons.push_back(reason);
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex::PipelineFileIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex::~PipelineFileIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex::PipelineFileIndex(const PipelineFileIndex&) = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex::PipelineFileIndex(PipelineFileIndex&&) noexcept = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex& PipelineFileIndex::operator=(const PipelineFileIndex&) = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex& PipelineFileIndex::operator=(PipelineFileIndex&&) noexcept = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex PipelineFileIndex::Build(const QStringList& filePaths, const std::atomic<bool>* cancel, bool readDream3DFiles)
+{
+  PipelineFileIndex index;
+  index.m_Entries.reserve(filePaths.size());
+
+  for(const QString& filePath : filePaths)
+  {
+    if(cancel != nullptr && cancel->load())
+    {
+      break;
+    }
+    index.m_Entries.push_back(ReadEntry(filePath, readDream3DFiles));
+  }
+
+  return index;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileIndex::ClearCache()
+{
+  QMutexLocker locker(&s_CacheMutex);
+  s_EntryCache.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndex::Entry PipelineFileIndex::ReadEntry(const QString& filePath, bool readDream3DFiles)
+{
+  QFileInfo fi(filePath);
+
+  Entry entry;
+  entry.filePath = fi.absoluteFilePath();
+  entry.exists = fi.exists();
+  if(!entry.exists)
+  {
+    return entry;
+  }
+  entry.size = fi.size();
+  entry.lastModified = fi.lastModified();
+
+  {
+    QMutexLocker locker(&s_CacheMutex);
+    auto iter = s_EntryCache.constFind(entry.filePath);
+    if(iter != s_EntryCache.constEnd() && iter.value().size == entry.size && iter.value().lastModified == entry.lastModified)
+    {
+      return iter.value();
+    }
+  }
+
+  QJsonObject json;
+  QString ext = fi.suffix().toLower();
+  if(ext == "dream3d" && !readDream3DFiles)
+  {
+    // Deferred entries are not cached so the file is read by a later build
+    entry.deferred = true;
+    entry.pipelineName = fi.completeBaseName();
+    return entry;
+  }
+  if(ext == "dream3d")
+  {
+    bool blocked = false;
+    PipelineFileLoader::ReadDream3DPipelineJson(entry.filePath, json, &blocked);
+    if(blocked)
+    {
+      // A pipeline started after this build did
+      entry.deferred = true;
+      entry.pipelineName = fi.completeBaseName();
+      return entry;
+    }
+  }
+  else if(ext == "json")
+  {
+    QFile file(entry.filePath);
+    if(file.open(QIODevice::ReadOnly))
+    {
+      json = QJsonDocument::fromJson(file.readAll()).object();
+    }
+  }
+  ReadPipelineJson(json, entry);
+
+  if(entry.pipelineName.isEmpty())
+  {
+    entry.pipelineName = fi.completeBaseName();
+  }
+
+  QMutexLocker locker(&s_CacheMutex);
+  s_EntryCache.insert(entry.filePath, entry);
+  return entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileIndex::ReadPipelineJson(const QJsonObject& json, Entry& entry)
+{
+  entry.pipelineName = json[k_PipelineBuilderKey].toObject()[k_PipelineNameKey].toString();
+
+  // Filters are stored under their zero based index: "0", "1", ...
+  for(int i = 0;; i++)
+  {
+    QJsonValue filterValue = json[QString::number(i)];
+    if(!filterValue.isObject())
+    {
+      break;
+    }
+
+    QJsonObject filterObj = filterValue.toObject();
+    entry.filterLabels.push_back(filterObj[k_FilterHumanLabelKey].toString());
+    entry.filterClassNames.push_back(filterObj[k_FilterNameKey].toString());
+
+    for(auto iter = filterObj.constBegin(); iter != filterObj.constEnd(); ++iter)
+    {
+      if(!iter.key().startsWith(k_FilterKeyPrefix))
+      {
+        CollectValues(iter.value(), 0, entry.values);
+      }
+    }
+  }
+
+  entry.filterLabels.removeAll(QString());
+  entry.filterClassNames.removeAll(QString());
+  entry.values.removeDuplicates();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<PipelineFileIndex::Match> PipelineFileIndex::find(const QString& text) const
+{
+  QVector<Match> matches;
+  QString needle = text.trimmed();
+  if(needle.isEmpty())
+  {
+    return matches;
+  }
+
+  for(const Entry& entry : m_Entries)
+  {
+    Match match;
+    match.filePath = entry.filePath;
+    match.pipelineName = entry.pipelineName;
+
+    if(entry.pipelineName.contains(needle, Qt::CaseInsensitive) || entry.filePath.contains(needle, Qt::CaseInsensitive))
+    {
+      AddReason(match, QObject::tr("Pipeline: %1").arg(entry.pipelineName));
+    }
+    for(int i = 0; i < entry.filterLabels.size(); i++)
+    {
+      if(entry.filterLabels[i].contains(needle, Qt::CaseInsensitive))
+      {
+        AddReason(match, QObject::tr("Filter: %1").arg(entry.filterLabels[i]));
+      }
+    }
+    for(const QString& className : entry.filterClassNames)
+    {
+      if(className.contains(needle, Qt::CaseInsensitive))
+      {
+        AddReason(match, QObject::tr("Filter: %1").arg(className));
+      }
+    }
+    for(const QString& value : entry.values)
+    {
+      if(match.reasons.size() >= k_MaxReasons)
+      {
+        break;
+      }
+      if(value.contains(needle, Qt::CaseInsensitive))
+      {
+        AddReason(match, QObject::tr("Value: %1").arg(value));
+      }
+    }
+
+    if(!match.reasons.isEmpty())
+    {
+      matches.push_back(match);
+    }
+  }
+
+  return matches;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QVector<PipelineFileIndex::Entry>& PipelineFileIndex::getEntries() const
+{
+  return m_Entries;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PipelineFileIndex::getMissingFiles() const
+{
+  QStringList missingFiles;
+  for(const Entry& entry : m_Entries)
+  {
+    if(!entry.exists)
+    {
+      missingFiles.push_back(entry.filePath);
+    }
+  }
+  return missingFiles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineFileIndex::hasDeferredFiles() const
+{
+  return std::any_of(m_Entries.cbegin(), m_Entries.cend(), [](const Entry& entry) { return entry.deferred; });
+}
@@ -0,0 +1,149 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+/**
+ * @brief The PipelineFileIndex class is a searchable summary of a set of pipeline files: which
+ * filters each file uses and which parameter values, such as input paths, it holds. The files are
+ * read as plain JSON without creating any filters, so an index can be built on a worker thread.
+ * Summaries are cached by file path, size and modification time, so rebuilding the index only
+ * reads files that changed.
+ */
+class PipelineFileIndex
+{
+public:
+  /**
+   * @brief The summary of one pipeline file
+   */
+  struct Entry
+  {
+    QString filePath;
+    bool exists = false;
+    bool deferred = false;
+    qint64 size = 0;
+    QDateTime lastModified;
+    QString pipelineName;
+    QStringList filterLabels;
+    QStringList filterClassNames;
+    QStringList values;
+  };
+
+  /**
+   * @brief A file that matched a search and the reasons why it matched
+   */
+  struct Match
+  {
+    QString filePath;
+    QString pipelineName;
+    QStringList reasons;
+  };
+
+  PipelineFileIndex();
+  ~PipelineFileIndex();
+
+  PipelineFileIndex(const PipelineFileIndex&);
+  PipelineFileIndex(PipelineFileIndex&&) noexcept;
+  PipelineFileIndex& operator=(const PipelineFileIndex&);
+  PipelineFileIndex& operator=(PipelineFileIndex&&) noexcept;
+
+  /**
+   * @brief Reads the given pipeline files and builds an index over them. This may be called
+   * from any thread.
+   * @param filePaths
+   * @param cancel Set to true to stop early; the files read so far are returned
+   * @param readDream3DFiles If false, .dream3d files that are not cached yet are only checked for
+   * existence and marked as deferred. HDF5 is not thread safe, so they must not be read while a
+   * pipeline uses HDF5 on another thread.
+   * @return
+   */
+  static PipelineFileIndex Build(const QStringList& filePaths, const std::atomic<bool>* cancel = nullptr, bool readDream3DFiles = true);
+
+  /**
+   * @brief Forgets every cached file summary
+   */
+  static void ClearCache();
+
+  /**
+   * @brief Returns the files whose pipeline name, filters or parameter values contain the text
+   * @param text Case insensitive
+   * @return
+   */
+  QVector<Match> find(const QString& text) const;
+
+  /**
+   * @brief Returns the summary of every indexed file
+   * @return
+   */
+  const QVector<Entry>& getEntries() const;
+
+  /**
+   * @brief Returns the paths of the indexed files that no longer exist
+   * @return
+   */
+  QStringList getMissingFiles() const;
+
+  /**
+   * @brief Returns true if some .dream3d files were skipped and still need to be read
+   * @return
+   */
+  bool hasDeferredFiles() const;
+
+private:
+  QVector<Entry> m_Entries;
+
+  /**
+   * @brief Reads the summary of one pipeline file, using the cache when the file is unchanged
+   * @param filePath
+   * @param readDream3DFiles
+   * @return
+   */
+  static Entry ReadEntry(const QString& filePath, bool readDream3DFiles);
+
+  /**
+   * @brief Fills the entry from a pipeline's JSON
+   * @param json
+   * @param entry
+   */
+  static void ReadPipelineJson(const QJsonObject& json, Entry& entry);
+};
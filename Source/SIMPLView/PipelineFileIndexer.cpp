@@ -0,0 +1,269 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineFileIndexer.h"
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTimer>
+
+#include "SVWidgetsLib/QtSupport/QtSRecentFileList.h"
+#include "SVWidgetsLib/Widgets/BookmarksModel.h"
+
+#include "SIMPLView/SIMPLViewApplication.h"
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+namespace
+{
+// Milliseconds between the last change to the bookmarks or recent files and the rebuild
+constexpr int k_RebuildDelay = 1000;
+// Milliseconds between rebuilds that pick up files edited or deleted outside of SIMPLView
+constexpr int k_RefreshInterval = 5 * 60 * 1000;
+
+/**
+ * @brief Returns the path used to identify a pipeline file
+ * @param filePath
+ * @return
+ */
+QString CleanFilePath(const QString& filePath)
+{
+  return QDir::cleanPath(QFileInfo(filePath).absoluteFilePath());
+}
+
+/**
+ * @brief Collects the file path of every bookmark below the parent
+ * @param model
+ * @param parent
+ * @param filePaths
+ */
+void CollectBookmarkPaths(const QAbstractItemModel* model, const QModelIndex& parent, QStringList& filePaths)
+{
+  for(int row = 0; row < model->rowCount(parent); row++)
+  {
+    QModelIndex index = model->index(row, 0, parent);
+    QString filePath = model->data(index, static_cast<int>(BookmarksModel::Roles::PathRole)).toString();
+    if(!filePath.isEmpty())
+    {
+      filePaths.push_back(filePath);
+    }
+    if(model->hasChildren(index))
+    {
+      CollectBookmarkPaths(model, index, filePaths);
+    }
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndexer::PipelineFileIndexer(QObject* parent)
+: QObject(parent)
+, m_RebuildTimer(new QTimer(this))
+, m_RefreshTimer(new QTimer(this))
+, m_IndexWatcher(new QFutureWatcher<PipelineFileIndex>(this))
+{
+  m_RebuildTimer->setSingleShot(true);
+  m_RebuildTimer->setInterval(k_RebuildDelay);
+  connect(m_RebuildTimer, &QTimer::timeout, this, &PipelineFileIndexer::rebuild);
+
+  m_RefreshTimer->setInterval(k_RefreshInterval);
+  connect(m_RefreshTimer, &QTimer::timeout, this, &PipelineFileIndexer::rebuild);
+  m_RefreshTimer->start();
+
+  connect(m_IndexWatcher, &QFutureWatcher<PipelineFileIndex>::finished, this, &PipelineFileIndexer::indexFinished);
+
+  BookmarksModel* bookmarksModel = BookmarksModel::Instance();
+  connect(bookmarksModel, &BookmarksModel::rowsInserted, this, &PipelineFileIndexer::scheduleRebuild);
+  connect(bookmarksModel, &BookmarksModel::rowsRemoved, this, &PipelineFileIndexer::scheduleRebuild);
+  connect(bookmarksModel, &BookmarksModel::rowsMoved, this, &PipelineFileIndexer::scheduleRebuild);
+  connect(bookmarksModel, &BookmarksModel::modelReset, this, &PipelineFileIndexer::scheduleRebuild);
+  connect(bookmarksModel, &BookmarksModel::dataChanged, this, [this](const QModelIndex&, const QModelIndex&, const QVector<int>& roles) {
+    // Marking missing bookmarks changes the model as well, but not the file paths
+    if(roles.isEmpty() || roles.contains(static_cast<int>(BookmarksModel::Roles::PathRole)))
+    {
+      scheduleRebuild();
+    }
+  });
+  connect(QtSRecentFileList::Instance(), &QtSRecentFileList::fileListChanged, this, &PipelineFileIndexer::scheduleRebuild);
+  connect(dream3dApp, &SIMPLViewApplication::allPipelinesFinished, this, &PipelineFileIndexer::rebuildDeferredFiles);
+
+  scheduleRebuild();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndexer::~PipelineFileIndexer()
+{
+  if(m_IndexWatcher->isRunning())
+  {
+    m_CancelFlag->store(true);
+    m_IndexWatcher->waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PipelineFileIndexer::CollectPipelineFiles()
+{
+  QStringList filePaths;
+  CollectBookmarkPaths(BookmarksModel::Instance(), QModelIndex(), filePaths);
+  filePaths.append(QtSRecentFileList::Instance()->fileList());
+
+  for(QString& filePath : filePaths)
+  {
+    filePath = CleanFilePath(filePath);
+  }
+  filePaths.removeDuplicates();
+  return filePaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const PipelineFileIndex& PipelineFileIndexer::getIndex() const
+{
+  return m_Index;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineFileIndexer::isIndexed() const
+{
+  return m_Indexed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineFileIndexer::isBuilding() const
+{
+  return m_IndexWatcher->isRunning();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileIndexer::scheduleRebuild()
+{
+  m_RebuildTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileIndexer::rebuild()
+{
+  m_RebuildTimer->stop();
+  if(m_IndexWatcher->isRunning())
+  {
+    m_RebuildPending = true;
+    return;
+  }
+  m_RebuildPending = false;
+
+  // Running pipelines use HDF5 on their own threads without any lock SIMPLView could take, so
+  // .dream3d files are only read while nothing is running
+  bool readDream3DFiles = !dream3dApp->isAnyPipelineRunning();
+
+  QStringList filePaths = CollectPipelineFiles();
+  std::shared_ptr<std::atomic<bool>> cancelFlag = std::make_shared<std::atomic<bool>>(false);
+  m_CancelFlag = cancelFlag;
+  m_IndexWatcher->setFuture(QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), [filePaths, cancelFlag, readDream3DFiles] { return PipelineFileIndex::Build(filePaths, cancelFlag.get(), readDream3DFiles); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileIndexer::rebuildDeferredFiles()
+{
+  if(m_Index.hasDeferredFiles())
+  {
+    scheduleRebuild();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileIndexer::indexFinished()
+{
+  if(m_RebuildPending)
+  {
+    rebuild();
+    return;
+  }
+
+  m_Index = m_IndexWatcher->result();
+  m_Indexed = true;
+
+  QHash<QString, bool> existence;
+  for(const PipelineFileIndex::Entry& entry : m_Index.getEntries())
+  {
+    existence.insert(entry.filePath, entry.exists);
+  }
+  UpdateBookmarkStates(BookmarksModel::Instance(), QModelIndex(), existence);
+
+  Q_EMIT indexUpdated();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileIndexer::UpdateBookmarkStates(QAbstractItemModel* model, const QModelIndex& parent, const QHash<QString, bool>& existence)
+{
+  const int errorsRole = static_cast<int>(BookmarksModel::Roles::ErrorsRole);
+  for(int row = 0; row < model->rowCount(parent); row++)
+  {
+    QModelIndex index = model->index(row, 0, parent);
+    QString filePath = model->data(index, static_cast<int>(BookmarksModel::Roles::PathRole)).toString();
+    if(!filePath.isEmpty())
+    {
+      auto iter = existence.constFind(CleanFilePath(filePath));
+      if(iter != existence.constEnd() && model->data(index, errorsRole).toBool() == iter.value())
+      {
+        model->setData(index, !iter.value(), errorsRole);
+      }
+    }
+    if(model->hasChildren(index))
+    {
+      UpdateBookmarkStates(model, index, existence);
+    }
+  }
+}
@@ -0,0 +1,141 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+
+#include "SIMPLView/PipelineFileIndex.h"
+
+class QAbstractItemModel;
+class QModelIndex;
+class QTimer;
+
+/**
+ * @brief The PipelineFileIndexer class keeps a PipelineFileIndex over every bookmarked and
+ * recently opened pipeline up to date in the background. The index is rebuilt on a worker
+ * thread shortly after the bookmarks or the recent files change, and periodically so that
+ * edited and deleted files are noticed. After each build the bookmarks are marked with the
+ * cached existence of their files, so no bookmark file is checked on the GUI thread.
+ */
+class PipelineFileIndexer : public QObject
+{
+  Q_OBJECT
+
+public:
+  PipelineFileIndexer(QObject* parent = nullptr);
+  ~PipelineFileIndexer() override;
+
+  /**
+   * @brief Returns the bookmarked and recently opened pipeline files
+   * @return
+   */
+  static QStringList CollectPipelineFiles();
+
+  /**
+   * @brief Returns the most recently built index
+   * @return
+   */
+  const PipelineFileIndex& getIndex() const;
+
+  /**
+   * @brief Returns true once the first index has been built
+   * @return
+   */
+  bool isIndexed() const;
+
+  /**
+   * @brief Returns true while an index is being built
+   * @return
+   */
+  bool isBuilding() const;
+
+public Q_SLOTS:
+  /**
+   * @brief Rebuilds the index after a short delay, so that a burst of changes causes one build
+   */
+  void scheduleRebuild();
+
+  /**
+   * @brief Starts rebuilding the index on a worker thread
+   */
+  void rebuild();
+
+  /**
+   * @brief Rebuilds the index if .dream3d files were skipped while a pipeline was running
+   */
+  void rebuildDeferredFiles();
+
+Q_SIGNALS:
+  /**
+   * @brief Emitted when a new index is available
+   */
+  void indexUpdated();
+
+protected Q_SLOTS:
+  /**
+   * @brief Takes the new index from the worker thread
+   */
+  void indexFinished();
+
+private:
+  QTimer* m_RebuildTimer = nullptr;
+  QTimer* m_RefreshTimer = nullptr;
+  QFutureWatcher<PipelineFileIndex>* m_IndexWatcher = nullptr;
+  std::shared_ptr<std::atomic<bool>> m_CancelFlag;
+  PipelineFileIndex m_Index;
+  bool m_Indexed = false;
+  bool m_RebuildPending = false;
+
+  /**
+   * @brief Marks every bookmark below parent whose file is missing. Only bookmarks whose state
+   * changed are touched.
+   * @param model
+   * @param parent
+   * @param existence Cleaned absolute file path -> whether the file exists
+   */
+  static void UpdateBookmarkStates(QAbstractItemModel* model, const QModelIndex& parent, const QHash<QString, bool>& existence);
+
+public:
+  PipelineFileIndexer(const PipelineFileIndexer&) = delete;            // Copy Constructor Not Implemented
+  PipelineFileIndexer(PipelineFileIndexer&&) = delete;                 // Move Constructor Not Implemented
+  PipelineFileIndexer& operator=(const PipelineFileIndexer&) = delete; // Copy Assignment Not Implemented
+  PipelineFileIndexer& operator=(PipelineFileIndexer&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,267 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineFileLoader.h"
+
+#include <QtCore/QCache>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/IObserver.h"
+#include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+
+namespace
+{
+const QString k_PipelineGroupName("Pipeline");
+const QString k_PipelineAttributeName("Pipeline");
+const int k_MaxCachedPipelines = 64;
+
+/**
+ * @brief A .dream3d file is identified by its path, size and modification time
+ */
+struct Dream3DCacheEntry
+{
+  qint64 size = 0;
+  QDateTime lastModified;
+  QJsonObject json;
+};
+
+QMutex s_CacheMutex;
+// The HDF5 library is not built thread safe, so SIMPLView's own readers take turns. Running
+// pipelines use HDF5 without this lock, so a .dream3d file is only read while s_RunningPipelines
+// is 0. Both are changed and checked under this lock.
+QMutex s_H5Mutex;
+int s_RunningPipelines = 0;
+// The least recently used pipeline is dropped once the cache is full
+QCache<QString, Dream3DCacheEntry> s_Dream3DCache(k_MaxCachedPipelines);
+
+/**
+ * @brief Keeps the messages the pipeline readers report so they can be shown later
+ */
+class MessageCollector : public IObserver
+{
+public:
+  explicit MessageCollector(QVector<AbstractMessage::Pointer>* messages)
+  : m_Messages(messages)
+  {
+  }
+
+  void processPipelineMessage(const AbstractMessage::Pointer& msg) override
+  {
+    m_Messages->push_back(msg);
+  }
+
+private:
+  QVector<AbstractMessage::Pointer>* m_Messages = nullptr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineFileLoader::ReadDream3DPipelineJson(const QString& filePath, QJsonObject& json, bool* blocked)
+{
+  if(blocked != nullptr)
+  {
+    *blocked = false;
+  }
+
+  QFileInfo fi(filePath);
+  QString key = fi.absoluteFilePath();
+  qint64 size = fi.size();
+  QDateTime lastModified = fi.lastModified();
+
+  {
+    QMutexLocker locker(&s_CacheMutex);
+    const Dream3DCacheEntry* cached = s_Dream3DCache.object(key);
+    if(cached != nullptr && cached->size == size && cached->lastModified == lastModified)
+    {
+      json = cached->json;
+      return true;
+    }
+  }
+
+  QString jsonString;
+  {
+    QMutexLocker h5Locker(&s_H5Mutex);
+    if(s_RunningPipelines > 0)
+    {
+      if(blocked != nullptr)
+      {
+        *blocked = true;
+      }
+      return false;
+    }
+
+    hid_t fileId = QH5Utilities::openFile(filePath, true);
+    if(fileId < 0)
+    {
+      return false;
+    }
+
+    herr_t err = QH5Lite::readStringAttribute(fileId, k_PipelineGroupName, k_PipelineAttributeName, jsonString);
+    QH5Utilities::closeFile(fileId);
+    if(err < 0)
+    {
+      return false;
+    }
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(jsonString.toUtf8(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    return false;
+  }
+  json = doc.object();
+
+  QMutexLocker locker(&s_CacheMutex);
+  Dream3DCacheEntry* entry = new Dream3DCacheEntry;
+  entry->size = size;
+  entry->lastModified = lastModified;
+  entry->json = json;
+  s_Dream3DCache.insert(key, entry);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileLoader::BeginPipelineRun()
+{
+  QMutexLocker h5Locker(&s_H5Mutex);
+  s_RunningPipelines++;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileLoader::EndPipelineRun()
+{
+  QMutexLocker h5Locker(&s_H5Mutex);
+  Q_ASSERT(s_RunningPipelines > 0);
+  if(s_RunningPipelines > 0)
+  {
+    s_RunningPipelines--;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineFileLoader::ClearCache()
+{
+  QMutexLocker locker(&s_CacheMutex);
+  s_Dream3DCache.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileLoader::Result PipelineFileLoader::Load(const QString& filePath, QThread* targetThread)
+{
+  Result result;
+  result.filePath = filePath;
+
+  QFileInfo fi(filePath);
+  if(!fi.exists())
+  {
+    result.errorMessage = QObject::tr("The pipeline file '%1' does not exist.").arg(filePath);
+    return result;
+  }
+
+  MessageCollector collector(&result.messages);
+  QString ext = fi.suffix().toLower();
+  if(ext == "dream3d")
+  {
+    // Files written before pipelines were stored as JSON still need the full reader
+    QJsonObject json;
+    bool blocked = false;
+    if(ReadDream3DPipelineJson(filePath, json, &blocked))
+    {
+      JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+      result.pipeline = jsonReader->readPipelineFromJson(json, &collector);
+    }
+    else if(!blocked)
+    {
+      QMutexLocker h5Locker(&s_H5Mutex);
+      blocked = (s_RunningPipelines > 0);
+      if(!blocked)
+      {
+        result.pipeline = H5FilterParametersReader::ReadPipelineFromFile(filePath, &collector);
+      }
+    }
+
+    if(blocked)
+    {
+      result.errorMessage = QObject::tr("'%1' cannot be read while a pipeline is running. Open it again once the pipeline has finished.").arg(filePath);
+      return result;
+    }
+  }
+  else if(ext == "json")
+  {
+    JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+    result.pipeline = jsonReader->readPipelineFromFile(filePath, &collector);
+  }
+  else
+  {
+    result.errorMessage = QObject::tr("'%1' is not a .json or .dream3d pipeline file.").arg(filePath);
+    return result;
+  }
+
+  if(result.pipeline.get() == nullptr)
+  {
+    result.errorMessage = QObject::tr("A pipeline could not be read from '%1'.").arg(filePath);
+    return result;
+  }
+
+  // QObjects can only be moved to another thread by the thread that owns them
+  for(const AbstractFilter::Pointer& filter : result.pipeline->getFilterContainer())
+  {
+    filter->moveToThread(targetThread);
+  }
+  result.pipeline->moveToThread(targetThread);
+
+  return result;
+}
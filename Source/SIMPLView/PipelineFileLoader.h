@@ -0,0 +1,112 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+class QThread;
+
+/**
+ * @brief The PipelineFileLoader class reads a pipeline from a .json or .dream3d file. It is
+ * meant to run on a worker thread so that parsing the file and instantiating every filter does
+ * not block the GUI; the filters are handed over to the GUI thread once they are created.
+ * .dream3d files are read with HDF5, which running pipelines also use without any lock that
+ * SIMPLView can take. Windows report their runs with BeginPipelineRun() and EndPipelineRun(), and
+ * .dream3d files are refused while any run is in progress.
+ */
+class PipelineFileLoader
+{
+public:
+  /**
+   * @brief The result of reading a pipeline file
+   */
+  struct Result
+  {
+    QString filePath;
+    FilterPipeline::Pointer pipeline;
+    QString errorMessage;
+    // What the readers reported, e.g. unknown or renamed filters. They are shown on the GUI thread.
+    QVector<AbstractMessage::Pointer> messages;
+  };
+
+  /**
+   * @brief Reads the pipeline stored in filePath and moves the pipeline and its filters to targetThread
+   * @param filePath
+   * @param targetThread The thread that will own the filters, usually the GUI thread
+   * @return
+   */
+  static Result Load(const QString& filePath, QThread* targetThread);
+
+  /**
+   * @brief Reads only the pipeline JSON embedded in a .dream3d file. The file is opened, the
+   * pipeline attribute is read and the file is closed without touching any data. Results are
+   * cached by file path, size and modification time.
+   * @param filePath
+   * @param json
+   * @param blocked Set to true if the file was not read because a pipeline is running
+   * @return false if the file does not hold a JSON pipeline, e.g. because it was written by an old
+   * version, or if it could not be read now
+   */
+  static bool ReadDream3DPipelineJson(const QString& filePath, QJsonObject& json, bool* blocked = nullptr);
+
+  /**
+   * @brief Records that a pipeline is about to run. This waits for any .dream3d file that is being
+   * read, and no other is read until the matching EndPipelineRun() call.
+   */
+  static void BeginPipelineRun();
+
+  /**
+   * @brief Records that a pipeline started with BeginPipelineRun() has finished
+   */
+  static void EndPipelineRun();
+
+  /**
+   * @brief Forgets every cached .dream3d pipeline
+   */
+  static void ClearCache();
+
+public:
+  PipelineFileLoader() = delete;
+  PipelineFileLoader(const PipelineFileLoader&) = delete;            // Copy Constructor Not Implemented
+  PipelineFileLoader(PipelineFileLoader&&) = delete;                 // Move Constructor Not Implemented
+  PipelineFileLoader& operator=(const PipelineFileLoader&) = delete; // Copy Assignment Not Implemented
+  PipelineFileLoader& operator=(PipelineFileLoader&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,340 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineIssuesModel.h"
+
+#include <algorithm>
+
+#include <QtGui/QBrush>
+#include <QtGui/QFont>
+#include <QtGui/QGuiApplication>
+#include <QtGui/QPalette>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineIssuesModel::PipelineIssuesModel(QObject* parent)
+: QAbstractTableModel(parent)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineIssuesModel::~PipelineIssuesModel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineIssuesModel::rowCount(const QModelIndex& parent) const
+{
+  if(parent.isValid())
+  {
+    return 0;
+  }
+  return m_Issues.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineIssuesModel::columnCount(const QModelIndex& parent) const
+{
+  if(parent.isValid())
+  {
+    return 0;
+  }
+  return ColumnCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant PipelineIssuesModel::data(const QModelIndex& index, int role) const
+{
+  if(!index.isValid() || index.row() >= m_Issues.size())
+  {
+    return QVariant();
+  }
+
+  const Issue& issue = m_Issues[index.row()];
+
+  if(role == Qt::ForegroundRole && index.column() == TypeColumn && issue.type == IssueType::Error)
+  {
+    return QBrush(Qt::red);
+  }
+
+  if(role == FilterClassNameRole)
+  {
+    return m_Strings[issue.filterClassNameId];
+  }
+
+  // Filters with a class name link to their help, as in the old issues table
+  bool hasHelpLink = !m_Strings[issue.filterClassNameId].isEmpty();
+  if(hasHelpLink && index.column() == FilterColumn)
+  {
+    if(role == Qt::ForegroundRole)
+    {
+      return QGuiApplication::palette().brush(QPalette::Link);
+    }
+    if(role == Qt::FontRole)
+    {
+      QFont font;
+      font.setUnderline(true);
+      return font;
+    }
+    if(role == Qt::ToolTipRole)
+    {
+      return tr("Click to show the help for %1").arg(m_Strings[issue.filterNameId]);
+    }
+  }
+
+  if(role == Qt::ToolTipRole && index.column() == DescriptionColumn)
+  {
+    if(issue.count > 1)
+    {
+      return tr("%1\n\n%2 similar messages. The latest:\n%3").arg(m_Strings[issue.descriptionId]).arg(issue.count).arg(issue.lastDescription);
+    }
+    return m_Strings[issue.descriptionId];
+  }
+
+  if(role != Qt::DisplayRole)
+  {
+    return QVariant();
+  }
+
+  // Numeric columns return numbers so that sorting is numeric
+  switch(index.column())
+  {
+  case TypeColumn:
+    return issue.type == IssueType::Error ? tr("Error") : tr("Warning");
+  case IndexColumn:
+    return issue.pipelineIndex < 0 ? QVariant() : QVariant(issue.pipelineIndex);
+  case FilterColumn:
+    return m_Strings[issue.filterNameId];
+  case DescriptionColumn:
+    return m_Strings[issue.descriptionId];
+  case CodeColumn:
+    return issue.code;
+  case CountColumn:
+    return issue.count;
+  default:
+    return QVariant();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant PipelineIssuesModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if(orientation != Qt::Horizontal || role != Qt::DisplayRole)
+  {
+    return QAbstractTableModel::headerData(section, orientation, role);
+  }
+
+  switch(section)
+  {
+  case TypeColumn:
+    return tr("Type");
+  case IndexColumn:
+    return tr("Index");
+  case FilterColumn:
+    return tr("Filter");
+  case DescriptionColumn:
+    return tr("Description");
+  case CodeColumn:
+    return tr("Code");
+  case CountColumn:
+    return tr("Count");
+  default:
+    return QVariant();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineIssuesModel::intern(const QString& str)
+{
+  auto iter = m_StringIds.constFind(str);
+  if(iter != m_StringIds.constEnd())
+  {
+    return iter.value();
+  }
+
+  int id = m_Strings.size();
+  m_Strings.push_back(str);
+  m_StringIds.insert(str, id);
+  return id;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineIssuesModel::CreateDescriptionTemplate(const QString& description)
+{
+  QString result;
+  result.reserve(description.size());
+  bool inNumber = false;
+  for(const QChar& c : description)
+  {
+    if(c.isDigit())
+    {
+      if(!inNumber)
+      {
+        result.append(QLatin1Char('#'));
+      }
+      inNumber = true;
+    }
+    else
+    {
+      result.append(c);
+      inNumber = false;
+    }
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesModel::addIssue(IssueType type, int pipelineIndex, const QString& filterName, const QString& filterClassName, const QString& description, int code)
+{
+  Issue issue;
+  issue.type = type;
+  issue.pipelineIndex = pipelineIndex;
+  issue.filterNameId = intern(filterName);
+  issue.filterClassNameId = intern(filterClassName);
+  issue.templateId = intern(CreateDescriptionTemplate(description));
+  issue.descriptionId = -1;
+  issue.code = code;
+  issue.count = 1;
+  issue.lastDescription = description;
+  m_PendingIssues.push_back(issue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesModel::commitPendingIssues()
+{
+  if(m_PendingIssues.isEmpty())
+  {
+    return;
+  }
+
+  const int firstNewRow = m_Issues.size();
+  QVector<Issue> newIssues;
+  int firstChangedRow = firstNewRow;
+  int lastChangedRow = -1;
+
+  for(Issue& issue : m_PendingIssues)
+  {
+    if(issue.type == IssueType::Error)
+    {
+      m_ErrorCount++;
+    }
+    else
+    {
+      m_WarningCount++;
+    }
+
+    IssueKey key = {issue.type, issue.pipelineIndex, issue.filterNameId, issue.templateId, issue.code};
+    auto iter = m_IssueRows.constFind(key);
+    if(iter == m_IssueRows.constEnd())
+    {
+      issue.descriptionId = intern(issue.lastDescription);
+      m_IssueRows.insert(key, firstNewRow + newIssues.size());
+      newIssues.push_back(issue);
+      continue;
+    }
+
+    int row = iter.value();
+    Issue& merged = (row >= firstNewRow) ? newIssues[row - firstNewRow] : m_Issues[row];
+    merged.count++;
+    merged.lastDescription = issue.lastDescription;
+    if(row < firstNewRow)
+    {
+      firstChangedRow = std::min(firstChangedRow, row);
+      lastChangedRow = std::max(lastChangedRow, row);
+    }
+  }
+  m_PendingIssues.clear();
+
+  if(lastChangedRow >= 0)
+  {
+    Q_EMIT dataChanged(index(firstChangedRow, DescriptionColumn), index(lastChangedRow, CountColumn));
+  }
+
+  if(!newIssues.isEmpty())
+  {
+    beginInsertRows(QModelIndex(), firstNewRow, firstNewRow + newIssues.size() - 1);
+    m_Issues += newIssues;
+    endInsertRows();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesModel::clear()
+{
+  beginResetModel();
+  m_Issues.clear();
+  m_PendingIssues.clear();
+  m_IssueRows.clear();
+  m_Strings.clear();
+  m_StringIds.clear();
+  m_ErrorCount = 0;
+  m_WarningCount = 0;
+  endResetModel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineIssuesModel::getErrorCount() const
+{
+  return m_ErrorCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineIssuesModel::getWarningCount() const
+{
+  return m_WarningCount;
+}
@@ -0,0 +1,211 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QAbstractTableModel>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+/**
+ * @brief The PipelineIssuesModel class stores the errors and warnings generated by a preflight or
+ * a pipeline execution. Filter names and descriptions are interned so each issue is a handful
+ * of integers. Issues of the same filter and code whose descriptions only differ in their
+ * numbers, such as one warning per feature, are merged into one row with a count. New issues
+ * are staged with addIssue() and appended in a single batch by commitPendingIssues().
+ */
+class PipelineIssuesModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+public:
+  explicit PipelineIssuesModel(QObject* parent = nullptr);
+  ~PipelineIssuesModel() override;
+
+  enum class IssueType : int
+  {
+    Error = 0,
+    Warning = 1
+  };
+
+  enum Roles
+  {
+    // The class name of the filter, used to show its help. Empty for pipeline level issues.
+    FilterClassNameRole = Qt::UserRole + 1
+  };
+
+  enum Column
+  {
+    TypeColumn = 0,
+    IndexColumn,
+    FilterColumn,
+    DescriptionColumn,
+    CodeColumn,
+    CountColumn,
+    ColumnCount
+  };
+
+  /**
+   * @brief rowCount
+   * @param parent
+   * @return
+   */
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  /**
+   * @brief columnCount
+   * @param parent
+   * @return
+   */
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  /**
+   * @brief data
+   * @param index
+   * @param role
+   * @return
+   */
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  /**
+   * @brief headerData
+   * @param section
+   * @param orientation
+   * @param role
+   * @return
+   */
+  QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+  /**
+   * @brief Stages an issue. It is not visible until commitPendingIssues() is called.
+   * @param type
+   * @param pipelineIndex The index of the filter in the pipeline or -1 for pipeline level issues
+   * @param filterName
+   * @param filterClassName The class name used to show the filter's help, or empty
+   * @param description
+   * @param code
+   */
+  void addIssue(IssueType type, int pipelineIndex, const QString& filterName, const QString& filterClassName, const QString& description, int code);
+
+  /**
+   * @brief Returns description with every run of digits replaced by '#'. Issues with the same
+   * template are merged.
+   * @param description
+   * @return
+   */
+  static QString CreateDescriptionTemplate(const QString& description);
+
+  /**
+   * @brief Merges the staged issues into the model, adding rows for new issues and
+   * updating the counts of issues that are already shown
+   */
+  void commitPendingIssues();
+
+  /**
+   * @brief Removes all of the shown and staged issues
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of errors shown, counting merged duplicates
+   * @return
+   */
+  int getErrorCount() const;
+
+  /**
+   * @brief Returns the number of warnings shown, counting merged duplicates
+   * @return
+   */
+  int getWarningCount() const;
+
+private:
+  struct Issue
+  {
+    IssueType type;
+    int pipelineIndex;
+    int filterNameId;
+    int filterClassNameId;
+    int templateId;
+    int descriptionId;
+    int code;
+    int count;
+    // The description of the latest merged issue. Only the first description is interned, so a
+    // flood of distinct messages does not grow the string table.
+    QString lastDescription;
+  };
+
+  struct IssueKey
+  {
+    IssueType type;
+    int pipelineIndex;
+    int filterNameId;
+    int templateId;
+    int code;
+
+    bool operator==(const IssueKey& other) const
+    {
+      return type == other.type && pipelineIndex == other.pipelineIndex && filterNameId == other.filterNameId && templateId == other.templateId && code == other.code;
+    }
+
+    friend uint qHash(const IssueKey& key, uint seed = 0)
+    {
+      return qHash(key.templateId, seed) ^ qHash(key.filterNameId, seed + 1) ^ qHash(key.pipelineIndex, seed + 2) ^ qHash(key.code, seed + 3) ^ static_cast<uint>(key.type);
+    }
+  };
+
+  QVector<Issue> m_Issues;
+  QVector<Issue> m_PendingIssues;
+  QHash<IssueKey, int> m_IssueRows;
+
+  QVector<QString> m_Strings;
+  QHash<QString, int> m_StringIds;
+
+  int m_ErrorCount = 0;
+  int m_WarningCount = 0;
+
+  /**
+   * @brief Returns the id of str in the string table, adding it if needed
+   * @param str
+   * @return
+   */
+  int intern(const QString& str);
+
+public:
+  PipelineIssuesModel(const PipelineIssuesModel&) = delete;            // Copy Constructor Not Implemented
+  PipelineIssuesModel(PipelineIssuesModel&&) = delete;                 // Move Constructor Not Implemented
+  PipelineIssuesModel& operator=(const PipelineIssuesModel&) = delete; // Copy Assignment Not Implemented
+  PipelineIssuesModel& operator=(PipelineIssuesModel&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,232 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineIssuesWidget.h"
+
+#include <QtCore/QSortFilterProxyModel>
+#include <QtCore/QTimer>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QTableView>
+#include <QtWidgets/QVBoxLayout>
+
+#include "SIMPLib/Common/DocRequestManager.h"
+#include "SIMPLib/Messages/AbstractMessageHandler.h"
+#include "SIMPLib/Messages/FilterErrorMessage.h"
+#include "SIMPLib/Messages/FilterWarningMessage.h"
+#include "SIMPLib/Messages/PipelineErrorMessage.h"
+#include "SIMPLib/Messages/PipelineWarningMessage.h"
+
+#include "SIMPLView/PipelineIssuesModel.h"
+
+namespace
+{
+const int k_FilterDelay = 250;
+
+/**
+ * @brief Stages the error and warning messages in a PipelineIssuesModel
+ */
+class IssuesMessageHandler : public AbstractMessageHandler
+{
+public:
+  explicit IssuesMessageHandler(PipelineIssuesModel* model)
+  : m_Model(model)
+  {
+  }
+
+  void processMessage(const FilterErrorMessage* msg) const override
+  {
+    m_Model->addIssue(PipelineIssuesModel::IssueType::Error, msg->getPipelineIndex(), msg->getHumanLabel(), msg->getClassName(), msg->getMessageText(), msg->getCode());
+  }
+
+  void processMessage(const FilterWarningMessage* msg) const override
+  {
+    m_Model->addIssue(PipelineIssuesModel::IssueType::Warning, msg->getPipelineIndex(), msg->getHumanLabel(), msg->getClassName(), msg->getMessageText(), msg->getCode());
+  }
+
+  void processMessage(const PipelineErrorMessage* msg) const override
+  {
+    m_Model->addIssue(PipelineIssuesModel::IssueType::Error, -1, msg->getPipelineName(), QString(), msg->getMessageText(), msg->getCode());
+  }
+
+  void processMessage(const PipelineWarningMessage* msg) const override
+  {
+    m_Model->addIssue(PipelineIssuesModel::IssueType::Warning, -1, msg->getPipelineName(), QString(), msg->getMessageText(), msg->getCode());
+  }
+
+private:
+  PipelineIssuesModel* m_Model = nullptr;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineIssuesWidget::PipelineIssuesWidget(QWidget* parent)
+: QWidget(parent)
+, m_Model(new PipelineIssuesModel(this))
+, m_ProxyModel(new QSortFilterProxyModel(this))
+{
+  // With a dynamic sort filter, new rows are placed into the existing sort order
+  // and filter instead of re-sorting and re-filtering the whole table
+  m_ProxyModel->setSourceModel(m_Model);
+  m_ProxyModel->setDynamicSortFilter(true);
+  m_ProxyModel->setFilterCaseSensitivity(Qt::CaseInsensitive);
+  m_ProxyModel->setFilterKeyColumn(-1);
+
+  m_View = new QTableView(this);
+  m_View->setModel(m_ProxyModel);
+  m_View->setSortingEnabled(true);
+  m_View->sortByColumn(PipelineIssuesModel::IndexColumn, Qt::AscendingOrder);
+  m_View->setSelectionBehavior(QAbstractItemView::SelectRows);
+  m_View->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_View->setWordWrap(false);
+  m_View->setAlternatingRowColors(true);
+
+  // Fixed row heights keep the view from measuring every row
+  m_View->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+  m_View->verticalHeader()->setVisible(false);
+  m_View->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+  m_View->horizontalHeader()->setStretchLastSection(false);
+  m_View->horizontalHeader()->setSectionResizeMode(PipelineIssuesModel::DescriptionColumn, QHeaderView::Stretch);
+  connect(m_View, &QTableView::clicked, this, &PipelineIssuesWidget::showFilterHelp);
+
+  m_FilterEdit = new QLineEdit(this);
+  m_FilterEdit->setPlaceholderText(tr("Filter Issues"));
+  m_FilterEdit->setClearButtonEnabled(true);
+
+  m_FilterTimer = new QTimer(this);
+  m_FilterTimer->setSingleShot(true);
+  m_FilterTimer->setInterval(k_FilterDelay);
+  connect(m_FilterTimer, &QTimer::timeout, this, &PipelineIssuesWidget::applyFilter);
+  connect(m_FilterEdit, &QLineEdit::textChanged, m_FilterTimer, static_cast<void (QTimer::*)()>(&QTimer::start));
+
+  m_SummaryLabel = new QLabel(this);
+
+  QHBoxLayout* toolLayout = new QHBoxLayout();
+  toolLayout->addWidget(m_FilterEdit, 1);
+  toolLayout->addWidget(m_SummaryLabel);
+
+  QVBoxLayout* layout = new QVBoxLayout(this);
+  layout->setContentsMargins(4, 4, 4, 4);
+  layout->addLayout(toolLayout);
+  layout->addWidget(m_View, 1);
+
+  updateSummary();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineIssuesWidget::~PipelineIssuesWidget() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineIssuesModel* PipelineIssuesWidget::getModel() const
+{
+  return m_Model;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesWidget::processPipelineMessage(const AbstractMessage::Pointer& msg)
+{
+  IssuesMessageHandler msgHandler(m_Model);
+  msg->visit(&msgHandler);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesWidget::displayCachedMessages()
+{
+  m_Model->commitPendingIssues();
+  updateSummary();
+
+  int errCount = m_Model->getErrorCount();
+  Q_EMIT tableHasErrors(errCount > 0, errCount, m_Model->getWarningCount());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesWidget::clearIssues()
+{
+  m_Model->clear();
+  updateSummary();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesWidget::showFilterHelp(const QModelIndex& index)
+{
+  if(index.column() != PipelineIssuesModel::FilterColumn)
+  {
+    return;
+  }
+
+  QString className = index.data(PipelineIssuesModel::FilterClassNameRole).toString();
+  if(!className.isEmpty())
+  {
+    DocRequestManager::Instance()->requestFilterDocs(className);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesWidget::applyFilter()
+{
+  m_ProxyModel->setFilterFixedString(m_FilterEdit->text());
+  updateSummary();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineIssuesWidget::updateSummary()
+{
+  QString summary = tr("%1 Errors, %2 Warnings").arg(m_Model->getErrorCount()).arg(m_Model->getWarningCount());
+  if(m_ProxyModel->rowCount() != m_Model->rowCount())
+  {
+    summary += tr(" (showing %1 of %2 rows)").arg(m_ProxyModel->rowCount()).arg(m_Model->rowCount());
+  }
+  m_SummaryLabel->setText(summary);
+}
@@ -0,0 +1,118 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QWidget>
+
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+class PipelineIssuesModel;
+class QLabel;
+class QLineEdit;
+class QModelIndex;
+class QSortFilterProxyModel;
+class QTableView;
+class QTimer;
+
+/**
+ * @brief The PipelineIssuesWidget class is the contents of the Issues dock. It observes the
+ * pipeline messages, keeps the errors and warnings in a PipelineIssuesModel and shows them in a
+ * sortable, filterable table with fixed row heights so that only the visible rows are laid out.
+ */
+class PipelineIssuesWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  explicit PipelineIssuesWidget(QWidget* parent = nullptr);
+  ~PipelineIssuesWidget() override;
+
+  /**
+   * @brief getModel
+   * @return
+   */
+  PipelineIssuesModel* getModel() const;
+
+public Q_SLOTS:
+  /**
+   * @brief Caches the errors and warnings in msg until displayCachedMessages() is called
+   * @param msg
+   */
+  void processPipelineMessage(const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief Shows the cached errors and warnings in the table
+   */
+  void displayCachedMessages();
+
+  /**
+   * @brief Removes all of the errors and warnings
+   */
+  void clearIssues();
+
+Q_SIGNALS:
+  void tableHasErrors(bool hasErrors, int errCount, int warnCount);
+
+private:
+  PipelineIssuesModel* m_Model = nullptr;
+  QSortFilterProxyModel* m_ProxyModel = nullptr;
+  QTableView* m_View = nullptr;
+  QLineEdit* m_FilterEdit = nullptr;
+  QLabel* m_SummaryLabel = nullptr;
+  QTimer* m_FilterTimer = nullptr;
+
+  /**
+   * @brief Shows the help of the filter whose name was clicked
+   * @param index
+   */
+  void showFilterHelp(const QModelIndex& index);
+
+  /**
+   * @brief Applies the filter text to the table
+   */
+  void applyFilter();
+
+  /**
+   * @brief updateSummary
+   */
+  void updateSummary();
+
+public:
+  PipelineIssuesWidget(const PipelineIssuesWidget&) = delete;            // Copy Constructor Not Implemented
+  PipelineIssuesWidget(PipelineIssuesWidget&&) = delete;                 // Move Constructor Not Implemented
+  PipelineIssuesWidget& operator=(const PipelineIssuesWidget&) = delete; // Copy Assignment Not Implemented
+  PipelineIssuesWidget& operator=(PipelineIssuesWidget&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,159 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineMessageQueue.h"
+
+#include <utility>
+
+#include <QtCore/QMutexLocker>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMessageQueue::PipelineMessageQueue() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMessageQueue::~PipelineMessageQueue() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageQueue::pushStatusMessage(const QString& statusMessage, const QString& outputLine)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_ReceivedCount++;
+
+  m_Pending.statusMessage = statusMessage;
+
+  if(outputLine == m_LastOutputLine)
+  {
+    m_RepeatCount++;
+    m_MergedCount++;
+    return;
+  }
+
+  appendRepeatNote();
+  m_Pending.outputLines.push_back(outputLine);
+  m_LastOutputLine = outputLine;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageQueue::pushProgress(int progress)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_ReceivedCount++;
+
+  if(m_Pending.progress >= 0)
+  {
+    m_MergedCount++;
+  }
+  m_Pending.progress = progress;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineMessageQueue::requestFlush()
+{
+  QMutexLocker locker(&m_Mutex);
+  if(m_FlushRequested)
+  {
+    return false;
+  }
+
+  m_FlushRequested = true;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMessageQueue::Batch PipelineMessageQueue::takeBatch()
+{
+  QMutexLocker locker(&m_Mutex);
+  appendRepeatNote();
+
+  Batch batch;
+  std::swap(batch, m_Pending);
+  m_FlushRequested = false;
+  return batch;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageQueue::appendRepeatNote()
+{
+  if(m_RepeatCount == 0)
+  {
+    return;
+  }
+
+  m_Pending.outputLines.push_back(QString("      (previous message repeated %1 more times)").arg(m_RepeatCount));
+  m_RepeatCount = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineMessageQueue::getMergedMessageCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_MergedCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineMessageQueue::getReceivedMessageCount() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_ReceivedCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageQueue::resetCounters()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_MergedCount = 0;
+  m_ReceivedCount = 0;
+  m_LastOutputLine.clear();
+}
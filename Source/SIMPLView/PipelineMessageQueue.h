@@ -0,0 +1,129 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+/**
+ * @brief The PipelineMessageQueue class sits between a running pipeline and the SIMPLView_UI
+ * widgets. Messages may be pushed from the pipeline's worker thread; the GUI drains the queue
+ * on a timer so chatty filters cost one widget update per frame instead of one per message.
+ * Progress updates collapse to the latest value and consecutive identical output lines are
+ * merged into a single "repeated" note.
+ */
+class PipelineMessageQueue
+{
+public:
+  /**
+   * @brief Everything that accumulated since the last call to takeBatch()
+   */
+  struct Batch
+  {
+    QString statusMessage;
+    QStringList outputLines;
+    int progress = -1;
+  };
+
+  PipelineMessageQueue();
+  ~PipelineMessageQueue();
+
+  /**
+   * @brief Queues a status message
+   * @param statusMessage Text for the status bar
+   * @param outputLine Text for the pipeline output widget
+   */
+  void pushStatusMessage(const QString& statusMessage, const QString& outputLine);
+
+  /**
+   * @brief Queues a pipeline progress value, replacing any value that has not been shown yet
+   * @param progress
+   */
+  void pushProgress(int progress);
+
+  /**
+   * @brief Returns true exactly once after new messages arrive in an empty queue. The caller
+   * is then responsible for scheduling a call to takeBatch() on the GUI thread.
+   * @return
+   */
+  bool requestFlush();
+
+  /**
+   * @brief Removes and returns all of the queued messages
+   * @return
+   */
+  Batch takeBatch();
+
+  /**
+   * @brief Returns the number of messages that were merged into another message
+   * @return
+   */
+  size_t getMergedMessageCount() const;
+
+  /**
+   * @brief Returns the number of messages that were pushed into the queue
+   * @return
+   */
+  size_t getReceivedMessageCount() const;
+
+  /**
+   * @brief Resets the merged and received message counters
+   */
+  void resetCounters();
+
+private:
+  mutable QMutex m_Mutex;
+
+  Batch m_Pending;
+  QString m_LastOutputLine;
+  int m_RepeatCount = 0;
+  bool m_FlushRequested = false;
+
+  size_t m_MergedCount = 0;
+  size_t m_ReceivedCount = 0;
+
+  /**
+   * @brief Appends a note for the repeated output lines that were merged. The mutex must be held.
+   */
+  void appendRepeatNote();
+
+public:
+  PipelineMessageQueue(const PipelineMessageQueue&) = delete;            // Copy Constructor Not Implemented
+  PipelineMessageQueue(PipelineMessageQueue&&) = delete;                 // Move Constructor Not Implemented
+  PipelineMessageQueue& operator=(const PipelineMessageQueue&) = delete; // Copy Assignment Not Implemented
+  PipelineMessageQueue& operator=(PipelineMessageQueue&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,366 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineOutputModel.h"
+
+#include <algorithm>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineOutputModel::PipelineOutputModel(QObject* parent)
+: QAbstractListModel(parent)
+{
+  m_LogFile.setFileTemplate(QDir::tempPath() + "/SIMPLView-PipelineOutput-XXXXXX.log");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineOutputModel::~PipelineOutputModel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineOutputModel::rowCount(const QModelIndex& parent) const
+{
+  if(parent.isValid())
+  {
+    return 0;
+  }
+  return m_Count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant PipelineOutputModel::data(const QModelIndex& index, int role) const
+{
+  if(!index.isValid() || index.row() >= m_Count)
+  {
+    return QVariant();
+  }
+
+  if(role == Qt::DisplayRole || role == Qt::ToolTipRole)
+  {
+    return m_Lines[slot(index.row())];
+  }
+
+  return QVariant();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineOutputModel::slot(int row) const
+{
+  return (m_Head + row) % m_Capacity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputModel::appendLines(const QStringList& lines)
+{
+  if(lines.isEmpty())
+  {
+    return;
+  }
+
+  if(m_Lines.size() != m_Capacity)
+  {
+    m_Lines.resize(m_Capacity);
+  }
+
+  // A single batch that is larger than the whole buffer only keeps its newest lines in memory
+  int skipped = std::max(lines.size() - m_Capacity, 0);
+  int incoming = lines.size() - skipped;
+
+  int overflow = m_Count + incoming - m_Capacity;
+  if(overflow > 0)
+  {
+    beginRemoveRows(QModelIndex(), 0, overflow - 1);
+    QByteArray spilled;
+    for(int i = 0; i < overflow; i++)
+    {
+      QString& line = m_Lines[slot(i)];
+      spilled.append(line.toUtf8());
+      spilled.append('\n');
+      line.clear();
+    }
+    writeToLog(spilled);
+    m_SpilledLineCount += overflow;
+    m_Head = slot(overflow);
+    m_Count -= overflow;
+    endRemoveRows();
+  }
+
+  if(skipped > 0)
+  {
+    QByteArray spilled;
+    for(int i = 0; i < skipped; i++)
+    {
+      spilled.append(lines[i].toUtf8());
+      spilled.append('\n');
+    }
+    writeToLog(spilled);
+    m_SpilledLineCount += skipped;
+  }
+
+  beginInsertRows(QModelIndex(), m_Count, m_Count + incoming - 1);
+  for(int i = skipped; i < lines.size(); i++)
+  {
+    m_Lines[slot(m_Count)] = lines[i];
+    m_Count++;
+  }
+  endInsertRows();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputModel::writeToLog(const QByteArray& data)
+{
+  if(!m_LogFile.isOpen() && !m_LogFile.open())
+  {
+    return;
+  }
+  m_LogFile.write(data);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputModel::clear()
+{
+  beginResetModel();
+  m_Lines.clear();
+  m_Head = 0;
+  m_Count = 0;
+  if(m_LogFile.isOpen())
+  {
+    m_LogFile.resize(0);
+    m_LogFile.seek(0);
+  }
+  m_SpilledLineCount = 0;
+  endResetModel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineOutputModel::getLine(int row) const
+{
+  if(row < 0 || row >= m_Count)
+  {
+    return QString();
+  }
+  return m_Lines[slot(row)];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputModel::setCapacity(int capacity)
+{
+  if(capacity < 1 || capacity == m_Capacity)
+  {
+    return;
+  }
+  clear();
+  m_Capacity = capacity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineOutputModel::getCapacity() const
+{
+  return m_Capacity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelineOutputModel::getSpilledLineCount() const
+{
+  return m_SpilledLineCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineOutputModel::SearchSnapshot PipelineOutputModel::createSearchSnapshot()
+{
+  SearchSnapshot snapshot;
+  snapshot.lines.reserve(m_Count);
+  for(int row = 0; row < m_Count; row++)
+  {
+    snapshot.lines.push_back(m_Lines[slot(row)]);
+  }
+
+  if(m_LogFile.isOpen())
+  {
+    m_LogFile.flush();
+    snapshot.logFilePath = m_LogFile.fileName();
+    snapshot.logSize = m_LogFile.size();
+  }
+  snapshot.spilledLineCount = m_SpilledLineCount;
+  return snapshot;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineOutputModel::SearchResult PipelineOutputModel::Find(const SearchSnapshot& snapshot, const QString& text, int startRow, bool forward, const std::atomic<bool>* cancel)
+{
+  SearchResult result;
+  if(text.isEmpty())
+  {
+    return result;
+  }
+
+  auto isCanceled = [cancel] { return cancel != nullptr && cancel->load(); };
+  const int count = snapshot.lines.size();
+  int row = count > 0 ? std::min(std::max(startRow, 0), count - 1) : 0;
+
+  // The rows from startRow to the end in the search direction
+  int firstPassEnd = forward ? count : -1;
+  int step = forward ? 1 : -1;
+  for(int r = row; count > 0 && r != firstPassEnd; r += step)
+  {
+    if(snapshot.lines[r].contains(text, Qt::CaseInsensitive))
+    {
+      result.row = r;
+      return result;
+    }
+  }
+  if(isCanceled())
+  {
+    return result;
+  }
+
+  // The spilled lines lie before row 0. A forward search takes the first match, a backward
+  // search the last one.
+  if(!snapshot.logFilePath.isEmpty() && snapshot.logSize > 0)
+  {
+    QFile logFile(snapshot.logFilePath);
+    if(logFile.open(QIODevice::ReadOnly))
+    {
+      qint64 lineNumber = 0;
+      while(logFile.pos() < snapshot.logSize && lineNumber < snapshot.spilledLineCount)
+      {
+        QByteArray rawLine = logFile.readLine();
+        if(rawLine.isEmpty())
+        {
+          break;
+        }
+        if(rawLine.endsWith('\n'))
+        {
+          rawLine.chop(1);
+        }
+
+        QString line = QString::fromUtf8(rawLine);
+        if(line.contains(text, Qt::CaseInsensitive))
+        {
+          result.spilledLine = lineNumber;
+          result.spilledText = line;
+          if(forward)
+          {
+            return result;
+          }
+        }
+        lineNumber++;
+        if((lineNumber & 0x3FFF) == 0 && isCanceled())
+        {
+          return SearchResult();
+        }
+      }
+      if(result.spilledLine >= 0)
+      {
+        return result;
+      }
+    }
+  }
+
+  // The rows on the other side of startRow
+  int secondPassStart = forward ? 0 : count - 1;
+  for(int r = secondPassStart; count > 0 && r != row; r += step)
+  {
+    if(snapshot.lines[r].contains(text, Qt::CaseInsensitive))
+    {
+      result.row = r;
+      return result;
+    }
+  }
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineOutputModel::saveLog(const QString& filePath)
+{
+  QFile outFile(filePath);
+  if(!outFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+
+  if(m_LogFile.isOpen())
+  {
+    m_LogFile.flush();
+    QFile spillFile(m_LogFile.fileName());
+    if(spillFile.open(QIODevice::ReadOnly))
+    {
+      const qint64 k_ChunkSize = 1 << 20;
+      while(!spillFile.atEnd())
+      {
+        outFile.write(spillFile.read(k_ChunkSize));
+      }
+    }
+  }
+
+  for(int row = 0; row < m_Count; row++)
+  {
+    outFile.write(m_Lines[slot(row)].toUtf8());
+    outFile.write("\n", 1);
+  }
+
+  return outFile.error() == QFileDevice::NoError;
+}
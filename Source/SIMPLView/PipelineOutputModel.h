@@ -0,0 +1,188 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QStringList>
+#include <QtCore/QTemporaryFile>
+#include <QtCore/QVector>
+
+/**
+ * @brief The PipelineOutputModel class holds the most recent lines of pipeline output in a
+ * fixed size ring buffer. Appending is constant time per line no matter how long the pipeline
+ * has been running. Lines that fall out of the ring buffer are written to a temporary log
+ * file so that saving the log still produces the complete output. Searches run on a snapshot
+ * of the buffer and the log file, so they can run on a worker thread and cover every line.
+ */
+class PipelineOutputModel : public QAbstractListModel
+{
+  Q_OBJECT
+
+public:
+  explicit PipelineOutputModel(QObject* parent = nullptr);
+  ~PipelineOutputModel() override;
+
+  static const int k_DefaultCapacity = 100000;
+
+  /**
+   * @brief The lines a search runs over. The buffered lines are copied, which only copies the
+   * references to their shared data, and the spilled lines are read from the log file.
+   */
+  struct SearchSnapshot
+  {
+    QStringList lines;
+    QString logFilePath;
+    qint64 logSize = 0;
+    qint64 spilledLineCount = 0;
+  };
+
+  /**
+   * @brief The line a search found. row is the row in the snapshot, or -1 if the match is a
+   * spilled line, in which case spilledLine is its zero based line number in the log file.
+   */
+  struct SearchResult
+  {
+    int row = -1;
+    qint64 spilledLine = -1;
+    QString spilledText;
+  };
+
+  /**
+   * @brief rowCount
+   * @param parent
+   * @return
+   */
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  /**
+   * @brief data
+   * @param index
+   * @param role
+   * @return
+   */
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  /**
+   * @brief Appends lines to the end of the buffer, spilling the oldest lines to the log file
+   * @param lines
+   */
+  void appendLines(const QStringList& lines);
+
+  /**
+   * @brief Removes every line from the buffer and truncates the log file
+   */
+  void clear();
+
+  /**
+   * @brief Returns the line stored at the given row of the buffer
+   * @param row
+   * @return
+   */
+  QString getLine(int row) const;
+
+  /**
+   * @brief Sets the number of lines kept in memory. This clears the buffer.
+   * @param capacity
+   */
+  void setCapacity(int capacity);
+
+  /**
+   * @brief getCapacity
+   * @return
+   */
+  int getCapacity() const;
+
+  /**
+   * @brief Returns the number of lines that have been moved out of memory into the log file
+   * @return
+   */
+  qint64 getSpilledLineCount() const;
+
+  /**
+   * @brief Returns a snapshot of the buffered lines and the log file for Find()
+   * @return
+   */
+  SearchSnapshot createSearchSnapshot();
+
+  /**
+   * @brief Searches every line of the snapshot for text. The spilled lines come before the
+   * first row, and the search wraps around at either end. This may be called from any thread.
+   * @param snapshot
+   * @param text
+   * @param startRow The first row to test
+   * @param forward
+   * @param cancel Set to true to stop early
+   * @return The match, or a result with row and spilledLine both -1 if no line contains the text
+   */
+  static SearchResult Find(const SearchSnapshot& snapshot, const QString& text, int startRow, bool forward, const std::atomic<bool>* cancel = nullptr);
+
+  /**
+   * @brief Writes the spilled lines followed by the buffered lines to filePath
+   * @param filePath
+   * @return
+   */
+  bool saveLog(const QString& filePath);
+
+private:
+  QVector<QString> m_Lines;
+  int m_Capacity = k_DefaultCapacity;
+  int m_Head = 0;
+  int m_Count = 0;
+
+  QTemporaryFile m_LogFile;
+  qint64 m_SpilledLineCount = 0;
+
+  /**
+   * @brief Returns the ring buffer slot that holds the given row
+   * @param row
+   * @return
+   */
+  int slot(int row) const;
+
+  /**
+   * @brief Appends data to the log file, opening it on first use
+   * @param data
+   */
+  void writeToLog(const QByteArray& data);
+
+public:
+  PipelineOutputModel(const PipelineOutputModel&) = delete;            // Copy Constructor Not Implemented
+  PipelineOutputModel(PipelineOutputModel&&) = delete;                 // Move Constructor Not Implemented
+  PipelineOutputModel& operator=(const PipelineOutputModel&) = delete; // Copy Assignment Not Implemented
+  PipelineOutputModel& operator=(PipelineOutputModel&&) = delete;      // Move Assignment Not Implemented
+};
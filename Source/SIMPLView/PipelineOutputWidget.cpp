@@ -0,0 +1,318 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineOutputWidget.h"
+
+#include <algorithm>
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QDir>
+#include <QtGui/QClipboard>
+#include <QtGui/QGuiApplication>
+#include <QtWidgets/QAction>
+#include <QtWidgets/QFileDialog>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QListView>
+#include <QtWidgets/QMessageBox>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QScrollBar>
+#include <QtWidgets/QVBoxLayout>
+
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineOutputWidget::PipelineOutputWidget(QWidget* parent)
+: QWidget(parent)
+, m_Model(new PipelineOutputModel(this))
+, m_SearchWatcher(new QFutureWatcher<PipelineOutputModel::SearchResult>(this))
+{
+  connect(m_SearchWatcher, &QFutureWatcher<PipelineOutputModel::SearchResult>::finished, this, &PipelineOutputWidget::searchFinished);
+
+  m_View = new QListView(this);
+  m_View->setModel(m_Model);
+  m_View->setUniformItemSizes(true);
+  m_View->setSelectionMode(QAbstractItemView::ExtendedSelection);
+  m_View->setEditTriggers(QAbstractItemView::NoEditTriggers);
+  m_View->setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
+  m_View->setContextMenuPolicy(Qt::ActionsContextMenu);
+
+  QAction* copyAction = new QAction(tr("Copy"), m_View);
+  copyAction->setShortcut(QKeySequence::Copy);
+  copyAction->setShortcutContext(Qt::WidgetShortcut);
+  connect(copyAction, &QAction::triggered, this, &PipelineOutputWidget::copySelection);
+  m_View->addAction(copyAction);
+
+  m_SearchEdit = new QLineEdit(this);
+  m_SearchEdit->setPlaceholderText(tr("Search Output"));
+  m_SearchEdit->setClearButtonEnabled(true);
+  connect(m_SearchEdit, &QLineEdit::returnPressed, this, &PipelineOutputWidget::findNext);
+
+  QPushButton* previousBtn = new QPushButton(tr("Previous"), this);
+  connect(previousBtn, &QPushButton::clicked, this, &PipelineOutputWidget::findPrevious);
+  QPushButton* nextBtn = new QPushButton(tr("Next"), this);
+  connect(nextBtn, &QPushButton::clicked, this, &PipelineOutputWidget::findNext);
+  QPushButton* clearBtn = new QPushButton(tr("Clear"), this);
+  connect(clearBtn, &QPushButton::clicked, this, &PipelineOutputWidget::clearLog);
+  QPushButton* saveBtn = new QPushButton(tr("Save Log..."), this);
+  connect(saveBtn, &QPushButton::clicked, this, &PipelineOutputWidget::saveLog);
+
+  m_SpilledLabel = new QLabel(this);
+  m_SpilledLabel->setVisible(false);
+
+  m_SearchStatusLabel = new QLabel(this);
+  m_SearchStatusLabel->setWordWrap(true);
+  m_SearchStatusLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+  m_SearchStatusLabel->setVisible(false);
+
+  QHBoxLayout* toolLayout = new QHBoxLayout();
+  toolLayout->addWidget(m_SearchEdit, 1);
+  toolLayout->addWidget(previousBtn);
+  toolLayout->addWidget(nextBtn);
+  toolLayout->addStretch();
+  toolLayout->addWidget(clearBtn);
+  toolLayout->addWidget(saveBtn);
+
+  QVBoxLayout* layout = new QVBoxLayout(this);
+  layout->setContentsMargins(4, 4, 4, 4);
+  layout->addLayout(toolLayout);
+  layout->addWidget(m_SpilledLabel);
+  layout->addWidget(m_SearchStatusLabel);
+  layout->addWidget(m_View, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineOutputWidget::~PipelineOutputWidget()
+{
+  cancelSearch();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineOutputModel* PipelineOutputWidget::getModel() const
+{
+  return m_Model;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::appendText(const QString& text)
+{
+  // Only follow the output if the user has not scrolled up to read something
+  QScrollBar* scrollBar = m_View->verticalScrollBar();
+  bool atBottom = scrollBar->value() == scrollBar->maximum();
+
+  m_Model->appendLines(text.split('\n'));
+  updateSpilledLabel();
+
+  if(atBottom)
+  {
+    m_View->scrollToBottom();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::clearLog()
+{
+  cancelSearch();
+  m_SearchStatusLabel->setVisible(false);
+  m_Model->clear();
+  updateSpilledLabel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::saveLog()
+{
+  QString filePath = QFileDialog::getSaveFileName(this, tr("Save Pipeline Output"), QDir::homePath() + "/PipelineOutput.log", tr("Log Files (*.log *.txt);;All Files (*.*)"));
+  if(filePath.isEmpty())
+  {
+    return;
+  }
+
+  if(!m_Model->saveLog(filePath))
+  {
+    QMessageBox::critical(this, tr("Save Pipeline Output"), tr("The pipeline output could not be written to '%1'.").arg(filePath), QMessageBox::Ok);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::findNext()
+{
+  findText(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::findPrevious()
+{
+  findText(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::findText(bool forward)
+{
+  int startRow = forward ? 0 : m_Model->rowCount() - 1;
+  QModelIndex current = m_View->currentIndex();
+  if(current.isValid())
+  {
+    startRow = current.row() + (forward ? 1 : -1);
+    if(startRow >= m_Model->rowCount())
+    {
+      startRow = 0;
+    }
+    else if(startRow < 0)
+    {
+      startRow = m_Model->rowCount() - 1;
+    }
+  }
+
+  cancelSearch();
+  m_SearchText = m_SearchEdit->text();
+  if(m_SearchText.isEmpty())
+  {
+    m_SearchStatusLabel->setVisible(false);
+    return;
+  }
+
+  PipelineOutputModel::SearchSnapshot snapshot = m_Model->createSearchSnapshot();
+  m_SearchSpilledLineCount = snapshot.spilledLineCount;
+  QString text = m_SearchText;
+  std::shared_ptr<std::atomic<bool>> cancelFlag = std::make_shared<std::atomic<bool>>(false);
+  m_SearchCancelFlag = cancelFlag;
+  m_SearchWatcher->setFuture(QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), [snapshot, text, startRow, forward, cancelFlag] { return PipelineOutputModel::Find(snapshot, text, startRow, forward, cancelFlag.get()); }));
+
+  m_SearchStatusLabel->setText(tr("Searching..."));
+  m_SearchStatusLabel->setVisible(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::cancelSearch()
+{
+  if(m_SearchWatcher->isRunning())
+  {
+    m_SearchCancelFlag->store(true);
+    m_SearchWatcher->waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::searchFinished()
+{
+  if(m_SearchCancelFlag->load())
+  {
+    return;
+  }
+
+  PipelineOutputModel::SearchResult result = m_SearchWatcher->result();
+  qint64 spilledLine = result.spilledLine;
+  if(result.row >= 0)
+  {
+    // Lines may have been moved out of memory while the search ran
+    qint64 row = result.row - (m_Model->getSpilledLineCount() - m_SearchSpilledLineCount);
+    if(row >= 0 && row < m_Model->rowCount())
+    {
+      m_SearchStatusLabel->setVisible(false);
+      QModelIndex index = m_Model->index(static_cast<int>(row));
+      m_View->setCurrentIndex(index);
+      m_View->scrollTo(index, QAbstractItemView::PositionAtCenter);
+      return;
+    }
+    spilledLine = m_SearchSpilledLineCount + result.row;
+    result.spilledText = QString();
+  }
+
+  if(spilledLine >= 0)
+  {
+    QString message = tr("Line %1 of the saved log matches '%2', but it is no longer kept in memory and cannot be shown here.").arg(spilledLine + 1).arg(m_SearchText);
+    if(!result.spilledText.isEmpty())
+    {
+      message += "\n" + result.spilledText;
+    }
+    m_SearchStatusLabel->setText(message);
+    return;
+  }
+
+  m_SearchStatusLabel->setText(tr("No line contains '%1'.").arg(m_SearchText));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::copySelection()
+{
+  QModelIndexList indexes = m_View->selectionModel()->selectedRows();
+  std::sort(indexes.begin(), indexes.end(), [](const QModelIndex& a, const QModelIndex& b) { return a.row() < b.row(); });
+
+  QStringList lines;
+  lines.reserve(indexes.size());
+  for(const QModelIndex& index : indexes)
+  {
+    lines.push_back(m_Model->getLine(index.row()));
+  }
+  QGuiApplication::clipboard()->setText(lines.join('\n'));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineOutputWidget::updateSpilledLabel()
+{
+  qint64 spilled = m_Model->getSpilledLineCount();
+  m_SpilledLabel->setVisible(spilled > 0);
+  if(spilled > 0)
+  {
+    m_SpilledLabel->setText(tr("%1 earlier lines are no longer shown, but they are still searched. Use Save Log to export the complete output.").arg(spilled));
+  }
+}
@@ -0,0 +1,140 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <QtCore/QFutureWatcher>
+#include <QtWidgets/QWidget>
+
+#include "SIMPLView/PipelineOutputModel.h"
+
+class QLabel;
+class QLineEdit;
+class QListView;
+
+/**
+ * @brief The PipelineOutputWidget class is the contents of the Pipeline Output dock. It shows the
+ * pipeline output through a virtualized list view so that only the visible lines are laid out,
+ * which keeps appends cheap even after hours of output. Searches run on a worker thread and
+ * also cover the lines that were moved out of memory.
+ */
+class PipelineOutputWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  explicit PipelineOutputWidget(QWidget* parent = nullptr);
+  ~PipelineOutputWidget() override;
+
+  /**
+   * @brief getModel
+   * @return
+   */
+  PipelineOutputModel* getModel() const;
+
+public Q_SLOTS:
+  /**
+   * @brief Appends text to the output. Multi-line text is split into one row per line.
+   * @param text
+   */
+  void appendText(const QString& text);
+
+  /**
+   * @brief Removes all of the output
+   */
+  void clearLog();
+
+  /**
+   * @brief Asks for a file path and writes the complete output to it
+   */
+  void saveLog();
+
+  /**
+   * @brief Selects the next line that contains the search text
+   */
+  void findNext();
+
+  /**
+   * @brief Selects the previous line that contains the search text
+   */
+  void findPrevious();
+
+private:
+  PipelineOutputModel* m_Model = nullptr;
+  QListView* m_View = nullptr;
+  QLineEdit* m_SearchEdit = nullptr;
+  QLabel* m_SpilledLabel = nullptr;
+  QLabel* m_SearchStatusLabel = nullptr;
+
+  QFutureWatcher<PipelineOutputModel::SearchResult>* m_SearchWatcher = nullptr;
+  std::shared_ptr<std::atomic<bool>> m_SearchCancelFlag;
+  QString m_SearchText;
+  qint64 m_SearchSpilledLineCount = 0;
+
+  /**
+   * @brief Starts a search on a worker thread from the line after or before the current one
+   * @param forward
+   */
+  void findText(bool forward);
+
+  /**
+   * @brief Selects the line the search found, or reports a match among the spilled lines
+   */
+  void searchFinished();
+
+  /**
+   * @brief Stops a running search and waits for it
+   */
+  void cancelSearch();
+
+  /**
+   * @brief Copies the selected lines to the clipboard
+   */
+  void copySelection();
+
+  /**
+   * @brief updateSpilledLabel
+   */
+  void updateSpilledLabel();
+
+public:
+  PipelineOutputWidget(const PipelineOutputWidget&) = delete;            // Copy Constructor Not Implemented
+  PipelineOutputWidget(PipelineOutputWidget&&) = delete;                 // Move Constructor Not Implemented
+  PipelineOutputWidget& operator=(const PipelineOutputWidget&) = delete; // Copy Assignment Not Implemented
+  PipelineOutputWidget& operator=(PipelineOutputWidget&&) = delete;      // Move Assignment Not Implemented
+};
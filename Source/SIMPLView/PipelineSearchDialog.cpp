@@ -0,0 +1,209 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineSearchDialog.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QTreeWidget>
+#include <QtWidgets/QVBoxLayout>
+
+#include "SIMPLView/PipelineFileIndexer.h"
+
+namespace
+{
+enum Column
+{
+  PipelineColumn = 0,
+  DetailsColumn,
+  FileColumn
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineSearchDialog::PipelineSearchDialog(PipelineFileIndexer* indexer, QWidget* parent)
+: QDialog(parent)
+, m_Indexer(indexer)
+{
+  setWindowTitle(tr("Find Pipelines"));
+  resize(800, 500);
+
+  m_SearchEdit = new QLineEdit(this);
+  m_SearchEdit->setPlaceholderText(tr("Filter name, parameter value or file path"));
+  m_SearchEdit->setClearButtonEnabled(true);
+  connect(m_SearchEdit, &QLineEdit::textChanged, this, &PipelineSearchDialog::updateResults);
+
+  m_ResultsTree = new QTreeWidget(this);
+  m_ResultsTree->setRootIsDecorated(false);
+  m_ResultsTree->setUniformRowHeights(true);
+  m_ResultsTree->setHeaderLabels({tr("Pipeline"), tr("Matches"), tr("File")});
+  m_ResultsTree->header()->setSectionResizeMode(QHeaderView::Interactive);
+  m_ResultsTree->header()->setStretchLastSection(true);
+  connect(m_ResultsTree, &QTreeWidget::itemActivated, this, &PipelineSearchDialog::activateItem);
+
+  m_StatusLabel = new QLabel(this);
+
+  connect(m_Indexer, &PipelineFileIndexer::indexUpdated, this, &PipelineSearchDialog::indexUpdated);
+
+  QVBoxLayout* layout = new QVBoxLayout(this);
+  layout->addWidget(m_SearchEdit);
+  layout->addWidget(m_ResultsTree, 1);
+  layout->addWidget(m_StatusLabel);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineSearchDialog::~PipelineSearchDialog() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineSearchDialog::showEvent(QShowEvent* event)
+{
+  QDialog::showEvent(event);
+  m_SearchEdit->setFocus();
+
+  if(m_Indexer->isIndexed())
+  {
+    indexUpdated();
+    return;
+  }
+
+  m_StatusLabel->setText(tr("Indexing pipeline files..."));
+  if(!m_Indexer->isBuilding())
+  {
+    m_Indexer->rebuild();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineSearchDialog::indexUpdated()
+{
+  if(!isVisible())
+  {
+    return;
+  }
+
+  m_Index = m_Indexer->getIndex();
+
+  QString status = tr("%1 pipeline files indexed").arg(m_Index.getEntries().size());
+  int missingCount = m_Index.getMissingFiles().size();
+  if(missingCount > 0)
+  {
+    status += tr(", %1 missing").arg(missingCount);
+  }
+  if(m_Index.hasDeferredFiles())
+  {
+    status += tr(". Some .dream3d files are indexed once the running pipelines have finished.");
+  }
+  m_StatusLabel->setText(status);
+
+  updateResults();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineSearchDialog::updateResults()
+{
+  m_ResultsTree->setUpdatesEnabled(false);
+  m_ResultsTree->clear();
+
+  QString text = m_SearchEdit->text().trimmed();
+  if(text.isEmpty())
+  {
+    for(const PipelineFileIndex::Entry& entry : m_Index.getEntries())
+    {
+      QString details = tr("%1 filters").arg(entry.filterLabels.size());
+      if(!entry.exists)
+      {
+        details = tr("File is missing");
+      }
+      else if(entry.deferred)
+      {
+        details = tr("Not indexed while a pipeline is running");
+      }
+      addResult(entry.filePath, entry.pipelineName, details, entry.exists);
+    }
+  }
+  else
+  {
+    for(const PipelineFileIndex::Match& match : m_Index.find(text))
+    {
+      addResult(match.filePath, match.pipelineName, match.reasons.join("; "), true);
+    }
+  }
+
+  m_ResultsTree->resizeColumnToContents(PipelineColumn);
+  m_ResultsTree->setUpdatesEnabled(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineSearchDialog::addResult(const QString& filePath, const QString& pipelineName, const QString& details, bool exists)
+{
+  QTreeWidgetItem* item = new QTreeWidgetItem(m_ResultsTree);
+  item->setText(PipelineColumn, pipelineName.isEmpty() ? QFileInfo(filePath).completeBaseName() : pipelineName);
+  item->setText(DetailsColumn, details);
+  item->setText(FileColumn, QDir::toNativeSeparators(filePath));
+  item->setToolTip(FileColumn, QDir::toNativeSeparators(filePath));
+  item->setData(PipelineColumn, Qt::UserRole, filePath);
+  if(!exists)
+  {
+    item->setDisabled(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineSearchDialog::activateItem(QTreeWidgetItem* item)
+{
+  if(item == nullptr || item->isDisabled())
+  {
+    return;
+  }
+
+  Q_EMIT pipelineActivated(item->data(PipelineColumn, Qt::UserRole).toString());
+}
@@ -0,0 +1,115 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QDialog>
+
+#include "SIMPLView/PipelineFileIndex.h"
+
+class PipelineFileIndexer;
+class QLabel;
+class QLineEdit;
+class QTreeWidget;
+class QTreeWidgetItem;
+
+/**
+ * @brief The PipelineSearchDialog class answers "which of my pipelines use filter X or file Y"
+ * over every bookmarked and recently opened pipeline. It searches the index that the
+ * application's PipelineFileIndexer keeps up to date in the background, and shows each new
+ * index as soon as it is built. Files that no longer exist are marked as missing.
+ */
+class PipelineSearchDialog : public QDialog
+{
+  Q_OBJECT
+
+public:
+  PipelineSearchDialog(PipelineFileIndexer* indexer, QWidget* parent = nullptr);
+  ~PipelineSearchDialog() override;
+
+Q_SIGNALS:
+  /**
+   * @brief Emitted when the user opens one of the found pipelines
+   * @param filePath
+   */
+  void pipelineActivated(const QString& filePath);
+
+protected:
+  /**
+   * @brief Shows the current index, or starts the first build if there is none yet
+   * @param event
+   */
+  void showEvent(QShowEvent* event) override;
+
+protected Q_SLOTS:
+  /**
+   * @brief Takes the latest index from the indexer
+   */
+  void indexUpdated();
+
+  /**
+   * @brief Shows the files that match the search text
+   */
+  void updateResults();
+
+  /**
+   * @brief Emits pipelineActivated for the item
+   * @param item
+   */
+  void activateItem(QTreeWidgetItem* item);
+
+private:
+  QLineEdit* m_SearchEdit = nullptr;
+  QTreeWidget* m_ResultsTree = nullptr;
+  QLabel* m_StatusLabel = nullptr;
+
+  PipelineFileIndexer* m_Indexer = nullptr;
+  PipelineFileIndex m_Index;
+
+  /**
+   * @brief Adds a result row
+   * @param filePath
+   * @param pipelineName
+   * @param details
+   * @param exists
+   */
+  void addResult(const QString& filePath, const QString& pipelineName, const QString& details, bool exists);
+
+public:
+  PipelineSearchDialog(const PipelineSearchDialog&) = delete;            // Copy Constructor Not Implemented
+  PipelineSearchDialog(PipelineSearchDialog&&) = delete;                 // Move Constructor Not Implemented
+  PipelineSearchDialog& operator=(const PipelineSearchDialog&) = delete; // Copy Assignment Not Implemented
+  PipelineSearchDialog& operator=(PipelineSearchDialog&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,322 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PythonFilterWatcher.h"
+
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QSet>
+#include <QtCore/QThreadPool>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+namespace
+{
+const int k_CheckDelay = 500;
+const QString k_PythonFilePattern("*.py");
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PythonFilterWatcher::PythonFilterWatcher(QObject* parent)
+: QObject(parent)
+, m_FileSystemWatcher(new QFileSystemWatcher(this))
+, m_CheckTimer(new QTimer(this))
+, m_ScanWatcher(new QFutureWatcher<FileHashes>(this))
+{
+  m_CheckTimer->setSingleShot(true);
+  m_CheckTimer->setInterval(k_CheckDelay);
+
+  connect(m_FileSystemWatcher, &QFileSystemWatcher::directoryChanged, this, &PythonFilterWatcher::scheduleCheck);
+  connect(m_FileSystemWatcher, &QFileSystemWatcher::fileChanged, this, &PythonFilterWatcher::scheduleCheck);
+  connect(m_CheckTimer, &QTimer::timeout, this, &PythonFilterWatcher::checkForChanges);
+  connect(m_ScanWatcher, &QFutureWatcher<FileHashes>::finished, this, &PythonFilterWatcher::scanFinished);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PythonFilterWatcher::~PythonFilterWatcher()
+{
+  m_ScanWatcher->waitForFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PythonFilterWatcher::setSearchPaths(const QStringList& dirPaths)
+{
+  m_CheckTimer->stop();
+
+  m_SearchPaths.clear();
+  for(const QString& dirPath : dirPaths)
+  {
+    QFileInfo fi(dirPath);
+    if(fi.isDir())
+    {
+      m_SearchPaths.push_back(fi.absoluteFilePath());
+    }
+  }
+  m_SearchPaths.removeDuplicates();
+
+  // The files found by the first scan of the new paths are the baseline, not changes
+  m_FileHashes.clear();
+  m_BaselinePending = true;
+  updateWatchedPaths();
+  startScan();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PythonFilterWatcher::getSearchPaths() const
+{
+  return m_SearchPaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PythonFilterWatcher::getFilePaths() const
+{
+  return m_FileHashes.keys();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PythonFilterWatcher::HashFile(const QString& filePath)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return QByteArray();
+  }
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  if(!hash.addData(&file))
+  {
+    return QByteArray();
+  }
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PythonFilterWatcher::scheduleCheck()
+{
+  m_CheckTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PythonFilterWatcher::checkForChanges()
+{
+  startScan();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PythonFilterWatcher::startScan()
+{
+  if(m_ScanWatcher->isRunning())
+  {
+    m_RescanPending = true;
+    return;
+  }
+
+  m_ScanWatcher->setFuture(QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), &PythonFilterWatcher::ScanSearchPaths, m_SearchPaths));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PythonFilterWatcher::scanFinished()
+{
+  // A scan requested while this one ran may cover different paths or newer file contents
+  if(m_RescanPending)
+  {
+    m_RescanPending = false;
+    startScan();
+    return;
+  }
+
+  FileHashes currentHashes = m_ScanWatcher->result();
+  if(m_BaselinePending)
+  {
+    m_BaselinePending = false;
+    m_FileHashes = currentHashes;
+    updateWatchedPaths();
+    return;
+  }
+
+  QStringList changedFiles;
+  QStringList removedFiles;
+  DiffFileHashes(m_FileHashes, currentHashes, &changedFiles, &removedFiles);
+
+  m_FileHashes = currentHashes;
+  updateWatchedPaths();
+
+  if(!changedFiles.isEmpty() || !removedFiles.isEmpty())
+  {
+    Q_EMIT filesChanged(changedFiles, removedFiles);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PythonFilterWatcher::DiffFileHashes(const FileHashes& previousHashes, const FileHashes& currentHashes, QStringList* changedFiles, QStringList* removedFiles)
+{
+  changedFiles->clear();
+  for(auto iter = currentHashes.constBegin(); iter != currentHashes.constEnd(); ++iter)
+  {
+    auto previous = previousHashes.constFind(iter.key());
+    if(previous == previousHashes.constEnd() || previous.value() != iter.value())
+    {
+      changedFiles->push_back(iter.key());
+    }
+  }
+
+  removedFiles->clear();
+  for(auto iter = previousHashes.constBegin(); iter != previousHashes.constEnd(); ++iter)
+  {
+    if(!currentHashes.contains(iter.key()))
+    {
+      removedFiles->push_back(iter.key());
+    }
+  }
+
+  changedFiles->sort();
+  removedFiles->sort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PythonFilterWatcher::FileHashes PythonFilterWatcher::ScanSearchPaths(const QStringList& dirPaths)
+{
+  QStringList filePaths;
+  for(const QString& dirPath : dirPaths)
+  {
+    QDir dir(dirPath);
+    QFileInfoList fileInfos = dir.entryInfoList({k_PythonFilePattern}, QDir::Files | QDir::Readable);
+    for(const QFileInfo& fi : fileInfos)
+    {
+      filePaths.push_back(fi.absoluteFilePath());
+    }
+  }
+
+  // Reading and hashing the files is independent per file, so spread it over the application pool. The scan
+  // itself runs on that pool; waiting on a task that has not started yet runs it on this thread instead.
+  QThreadPool* pool = SIMPLViewThreadBudget::ApplicationPool();
+  int taskCount = std::max(std::min(pool->maxThreadCount(), filePaths.size()), 1);
+  QVector<QByteArray> fileHashes(filePaths.size());
+  QByteArray* fileHashData = fileHashes.data();
+  QVector<QFuture<void>> tasks;
+  for(int task = 0; task < taskCount; task++)
+  {
+    tasks.push_back(QtConcurrent::run(pool, [&filePaths, fileHashData, task, taskCount] {
+      for(int i = task; i < filePaths.size(); i += taskCount)
+      {
+        fileHashData[i] = PythonFilterWatcher::HashFile(filePaths[i]);
+      }
+    }));
+  }
+  for(QFuture<void>& future : tasks)
+  {
+    future.waitForFinished();
+  }
+
+  FileHashes hashes;
+  hashes.reserve(filePaths.size());
+  for(int i = 0; i < filePaths.size(); i++)
+  {
+    if(!fileHashes[i].isEmpty())
+    {
+      hashes.insert(filePaths[i], fileHashes[i]);
+    }
+  }
+  return hashes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PythonFilterWatcher::updateWatchedPaths()
+{
+  QSet<QString> wanted;
+  for(const QString& dirPath : m_SearchPaths)
+  {
+    wanted.insert(dirPath);
+  }
+  for(auto iter = m_FileHashes.constBegin(); iter != m_FileHashes.constEnd(); ++iter)
+  {
+    wanted.insert(iter.key());
+  }
+
+  QStringList watched = m_FileSystemWatcher->files() + m_FileSystemWatcher->directories();
+  QStringList stale;
+  for(const QString& path : watched)
+  {
+    if(!wanted.remove(path))
+    {
+      stale.push_back(path);
+    }
+  }
+
+  if(!stale.isEmpty())
+  {
+    m_FileSystemWatcher->removePaths(stale);
+  }
+  if(!wanted.isEmpty())
+  {
+    m_FileSystemWatcher->addPaths(wanted.values());
+  }
+}
@@ -0,0 +1,157 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+class QFileSystemWatcher;
+class QTimer;
+
+template <typename T>
+class QFutureWatcher;
+
+/**
+ * @brief The PythonFilterWatcher class watches the Python filter search paths and reports
+ * which filter files actually changed. Every file is identified by a hash of its contents,
+ * so touching a file or saving it without edits does not cause a reload. Notifications are
+ * debounced because editors usually write a file in several steps. Files are read and hashed
+ * on the application thread pool, never on the thread that owns the watcher.
+ */
+class PythonFilterWatcher : public QObject
+{
+  Q_OBJECT
+
+public:
+  using FileHashes = QHash<QString, QByteArray>;
+
+  PythonFilterWatcher(QObject* parent = nullptr);
+  ~PythonFilterWatcher() override;
+
+  /**
+   * @brief Sets the directories to watch and starts recording the current hash of every
+   * Python file in them. No change notification is sent for the files that are found.
+   * @param dirPaths
+   */
+  void setSearchPaths(const QStringList& dirPaths);
+
+  /**
+   * @brief Returns the watched directories
+   * @return
+   */
+  QStringList getSearchPaths() const;
+
+  /**
+   * @brief Returns the absolute paths of the Python files that are currently known
+   * @return
+   */
+  QStringList getFilePaths() const;
+
+  /**
+   * @brief Returns a hash of the file's contents or an empty array if the file cannot be read
+   * @param filePath
+   * @return
+   */
+  static QByteArray HashFile(const QString& filePath);
+
+  /**
+   * @brief Hashes every Python file in the given directories
+   * @param dirPaths
+   * @return
+   */
+  static FileHashes ScanSearchPaths(const QStringList& dirPaths);
+
+  /**
+   * @brief Compares two scans of the search paths. Both lists are sorted.
+   * @param previousHashes
+   * @param currentHashes
+   * @param changedFiles Set to the files that are new or whose hash differs
+   * @param removedFiles Set to the files that are no longer found
+   */
+  static void DiffFileHashes(const FileHashes& previousHashes, const FileHashes& currentHashes, QStringList* changedFiles, QStringList* removedFiles);
+
+Q_SIGNALS:
+  /**
+   * @brief Emitted when Python files were added or edited or removed
+   * @param changedFiles Absolute paths of the added or edited files
+   * @param removedFiles Absolute paths of the removed files
+   */
+  void filesChanged(const QStringList& changedFiles, const QStringList& removedFiles);
+
+protected Q_SLOTS:
+  /**
+   * @brief Restarts the debounce timer
+   */
+  void scheduleCheck();
+
+  /**
+   * @brief Starts rehashing the search paths
+   */
+  void checkForChanges();
+
+  /**
+   * @brief Records the hashes of a finished scan and emits filesChanged() for any differences
+   */
+  void scanFinished();
+
+private:
+  QFileSystemWatcher* m_FileSystemWatcher = nullptr;
+  QTimer* m_CheckTimer = nullptr;
+  QFutureWatcher<FileHashes>* m_ScanWatcher = nullptr;
+  QStringList m_SearchPaths;
+  FileHashes m_FileHashes;
+  bool m_BaselinePending = false;
+  bool m_RescanPending = false;
+
+  /**
+   * @brief Starts a scan on the application thread pool, or queues another one if a scan is running
+   */
+  void startScan();
+
+  /**
+   * @brief Makes the file system watcher match the search paths and the known files. Editors
+   * that save by replacing a file drop its watch, so this runs after every check.
+   */
+  void updateWatchedPaths();
+
+public:
+  PythonFilterWatcher(const PythonFilterWatcher&) = delete;            // Copy Constructor Not Implemented
+  PythonFilterWatcher(PythonFilterWatcher&&) = delete;                 // Move Constructor Not Implemented
+  PythonFilterWatcher& operator=(const PythonFilterWatcher&) = delete; // Copy Assignment Not Implemented
+  PythonFilterWatcher& operator=(PythonFilterWatcher&&) = delete;      // Move Assignment Not Implemented
+};
@@ -40,14 +40,21 @@
 
 #include <ctime>
 
+#include <QtCore/QFileInfo>
 #include <QtCore/QPluginLoader>
 #include <QtCore/QProcess>
 #include <QtCore/QThread>
+#include <QtCore/QTimer>
 
 #include <QtGui/QBitmap>
 #include <QtGui/QDesktopServices>
 #include <QtGui/QScreen>
+#include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QFileDialog>
+#include <QtWidgets/QFormLayout>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QSpinBox>
 #include <QtWidgets/QSplashScreen>
 
 #include <QtCore/QDebug>
@@ -71,8 +78,14 @@
 #include "SVWidgetsLib/Widgets/SVStyle.h"
 
 #include "SIMPLView/AboutSIMPLView.h"
+#include "SIMPLView/FilterHelpCache.h"
+#include "SIMPLView/PipelineFileIndex.h"
+#include "SIMPLView/PipelineFileIndexer.h"
+#include "SIMPLView/PipelineFileLoader.h"
+#include "SIMPLView/PythonFilterWatcher.h"
 #include "SIMPLView/SIMPLView.h"
 #include "SIMPLView/SIMPLViewConstants.h"
+#include "SIMPLView/SIMPLViewInstanceServer.h"
 #include "SIMPLView/SIMPLViewVersion.h"
 #include "SIMPLView/SIMPLView_UI.h"
 
@@ -84,6 +97,7 @@
 
 namespace Detail
 {
+const int k_HelpPrefetchDelay = 5000;
 
 // -----------------------------------------------------------------------------
 //
@@ -112,6 +126,7 @@ SIMPLViewApplication::SIMPLViewApplication(int& argc, char** argv)
 , m_ShowSplash(true)
 , m_SplashScreen(nullptr)
 , m_minSplashTime(3)
+, m_FilterHelpCache(std::make_shared<FilterHelpCache>())
 {
   // Automatically check for updates at startup if the user has indicated that preference before
   checkForUpdatesAtStartup();
@@ -122,6 +137,9 @@ SIMPLViewApplication::SIMPLViewApplication(int& argc, char** argv)
   style->loadStyleSheet(defaultLoadedThemePath);
 
   readSettings();
+  parseCommandLineArguments();
+
+  connect(this, &SIMPLViewApplication::filterFactoriesUpdated, [this] { m_FilterSearchIndex.invalidate(); });
 
   // Create the default menu bar
   createDefaultMenuBar();
@@ -249,6 +267,17 @@ bool SIMPLViewApplication::initialize(int argc, char* argv[])
   }
   QApplication::instance()->processEvents();
 
+  updateInstanceServer();
+
+  // Keeps the bookmarked and recent pipelines indexed and the bookmarks' file checks off the GUI thread
+  m_PipelineFileIndexer = new PipelineFileIndexer(this);
+
+  // Index the filters for the quick find dialog before the first query needs them
+  m_FilterSearchIndex.invalidate();
+
+  // Read every filter's help page into memory once startup has settled
+  QTimer::singleShot(Detail::k_HelpPrefetchDelay, this, [this] { m_FilterHelpCache->prefetchAllFilters(); });
+
   return true;
 }
 
@@ -535,6 +564,15 @@ void SIMPLViewApplication::listenClearSIMPLViewCacheTriggered()
     // Set a flag in the preferences file, so that we know that we are in "Reset Preferences" mode
     prefs->setValue("Program Mode", QString("Reset Preferences"));
 
+    // The in-memory caches are dropped right away
+    PipelineFileLoader::ClearCache();
+    PipelineFileIndex::ClearCache();
+    m_FilterHelpCache->clear();
+    if(m_PipelineFileIndexer != nullptr)
+    {
+      m_PipelineFileIndexer->scheduleRebuild();
+    }
+
     QMessageBox cacheClearedBox;
     title = QString("The cache has been cleared successfully. Please restart %1 for the changes to take effect.").arg(BrandedStrings::ApplicationName);
 
@@ -675,6 +713,62 @@ void SIMPLViewApplication::listenShowDataFolderTriggered()
   QtSFileUtils::ShowPathInGui(nullptr, dataDirectory);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::listenSetThreadBudgetTriggered()
+{
+  int coreCount = SIMPLViewThreadBudget::IdealThreadCount();
+
+  QDialog dialog;
+  dialog.setWindowTitle(tr("Thread Budget"));
+
+  QLabel* coresLabel = new QLabel(tr("All open pipelines share these threads. %1 logical cores are available.").arg(coreCount), &dialog);
+  coresLabel->setWordWrap(true);
+
+  QSpinBox* threadsSpinBox = new QSpinBox(&dialog);
+  threadsSpinBox->setRange(0, coreCount);
+  threadsSpinBox->setSpecialValueText(tr("All Cores"));
+  threadsSpinBox->setValue(m_ThreadBudget.getMaxThreadCount());
+
+  QLineEdit* affinityLineEdit = new QLineEdit(m_ThreadBudget.getCpuAffinity(), &dialog);
+  affinityLineEdit->setPlaceholderText(tr("All CPUs (example: 0-15,32-47)"));
+
+  QDialogButtonBox* buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, &dialog);
+  connect(buttonBox, &QDialogButtonBox::accepted, &dialog, &QDialog::accept);
+  connect(buttonBox, &QDialogButtonBox::rejected, &dialog, &QDialog::reject);
+
+  QFormLayout* layout = new QFormLayout(&dialog);
+  layout->addRow(coresLabel);
+  layout->addRow(tr("Maximum Threads"), threadsSpinBox);
+  layout->addRow(tr("CPU Affinity"), affinityLineEdit);
+  layout->addRow(buttonBox);
+
+  if(dialog.exec() != QDialog::Accepted)
+  {
+    return;
+  }
+
+  QString cpuAffinity = affinityLineEdit->text().trimmed();
+  if(cpuAffinity != m_ThreadBudget.getCpuAffinity() && !m_ThreadBudget.setCpuAffinity(cpuAffinity))
+  {
+    QMessageBox::warning(nullptr, tr("Thread Budget"), tr("The CPU affinity \"%1\" could not be applied.").arg(cpuAffinity));
+    cpuAffinity = m_ThreadBudget.getCpuAffinity();
+  }
+  m_ThreadBudget.setMaxThreadCount(threadsSpinBox->value());
+
+  QtSSettings prefs;
+  prefs.beginGroup(SIMPLView::ThreadSettings::GroupName);
+  prefs.setValue(SIMPLView::ThreadSettings::MaximumThreads, m_ThreadBudget.getMaxThreadCount());
+  prefs.setValue(SIMPLView::ThreadSettings::CpuAffinity, cpuAffinity);
+  prefs.endGroup();
+
+  if(m_ActiveWindow != nullptr)
+  {
+    m_ActiveWindow->setStatusBarMessage(tr("Pipelines will use up to %1 threads.").arg(m_ThreadBudget.getEffectiveThreadCount()));
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -937,7 +1031,14 @@ bool SIMPLViewApplication::event(QEvent* event)
     QFileOpenEvent* openEvent = static_cast<QFileOpenEvent*>(event);
     QString filePath = openEvent->file();
 
-    newInstanceFromFile(filePath);
+    if(m_FileOpensHeld)
+    {
+      m_HeldFilePaths.push_back(filePath);
+    }
+    else
+    {
+      newInstanceFromFile(filePath);
+    }
   }
 #endif
 
@@ -1017,73 +1118,482 @@ void SIMPLViewApplication::readSettings()
 #endif
 
   prefs->endGroup();
+
+  prefs->beginGroup(SIMPLView::ThreadSettings::GroupName);
+  QString cpuAffinity = prefs->value(SIMPLView::ThreadSettings::CpuAffinity, QString()).toString();
+  if(!cpuAffinity.isEmpty())
+  {
+    m_ThreadBudget.setCpuAffinity(cpuAffinity);
+  }
+  m_ThreadBudget.setMaxThreadCount(prefs->value(SIMPLView::ThreadSettings::MaximumThreads, QVariant(0)).toInt());
+  prefs->endGroup();
+
+  prefs->beginGroup(SIMPLView::InstanceSettings::GroupName);
+  m_SingleInstanceEnabled = prefs->value(SIMPLView::InstanceSettings::SingleInstance, QVariant(false)).toBool();
+  prefs->endGroup();
+
+  prefs->beginGroup(SIMPLView::MemorySettings::GroupName);
+  m_RetainFreedMemoryEnabled = prefs->value(SIMPLView::MemorySettings::RetainFreedMemory, QVariant(false)).toBool();
+  prefs->endGroup();
+
+  // The heap can only be tuned once per session, so a changed preference waits for a restart
+  if(m_RetainFreedMemoryEnabled && !m_MemoryPolicy.retainFreedMemory())
+  {
+    qDebug() << "The heap could not be tuned to retain freed memory";
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::parseCommandLineArguments()
+{
+  // Pull the thread budget and instance options out of the command line. These override the preferences for
+  // this session only and are applied before any pipeline can start so that every worker thread inherits them.
+  QStringList arguments = QApplication::arguments();
+  for(int i = 1; i < arguments.size(); i++)
+  {
+    const QString& argument = arguments[i];
+    if(argument == SIMPLView::ThreadSettings::MaxThreadsArgument || argument == SIMPLView::ThreadSettings::CpuAffinityArgument)
+    {
+      if(i + 1 >= arguments.size() || arguments[i + 1].startsWith("--"))
+      {
+        qDebug() << "Missing value for the command line option" << argument;
+        continue;
+      }
+
+      const QString& value = arguments[++i];
+      if(argument == SIMPLView::ThreadSettings::CpuAffinityArgument)
+      {
+        m_ThreadBudget.setCpuAffinity(value);
+        continue;
+      }
+
+      bool ok = false;
+      int maxThreads = value.toInt(&ok);
+      if(!ok)
+      {
+        qDebug() << "Invalid value for the command line option" << argument << ":" << value;
+        continue;
+      }
+      m_ThreadBudget.setMaxThreadCount(maxThreads);
+    }
+    else if(argument == SIMPLView::InstanceSettings::SingleInstanceArgument)
+    {
+      m_SingleInstanceEnabled = true;
+    }
+    else if(argument == SIMPLView::InstanceSettings::NewInstanceArgument)
+    {
+      m_SingleInstanceEnabled = false;
+    }
+    else if(argument.startsWith("-") && !QFileInfo::exists(argument))
+    {
+      // Options this parser does not know are not files. macOS passes a process serial number as -psn_*.
+      if(!argument.startsWith("-psn_"))
+      {
+        qDebug() << "Ignoring the unknown command line option" << argument;
+      }
+    }
+    else
+    {
+      m_CommandLineFilePaths.push_back(argument);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewApplication::isSingleInstanceEnabled() const
+{
+  return m_SingleInstanceEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::setSingleInstanceEnabled(bool enabled)
+{
+  QtSSettings prefs;
+  prefs.beginGroup(SIMPLView::InstanceSettings::GroupName);
+  prefs.setValue(SIMPLView::InstanceSettings::SingleInstance, enabled);
+  prefs.endGroup();
+
+  if(enabled == m_SingleInstanceEnabled)
+  {
+    return;
+  }
+  m_SingleInstanceEnabled = enabled;
+  updateInstanceServer();
+
+  Q_EMIT singleInstanceEnabledChanged(enabled);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::setRetainFreedMemory(bool retain)
+{
+  if(retain == m_RetainFreedMemoryEnabled)
+  {
+    return;
+  }
+  m_RetainFreedMemoryEnabled = retain;
+
+  QtSSettings prefs;
+  prefs.beginGroup(SIMPLView::MemorySettings::GroupName);
+  prefs.setValue(SIMPLView::MemorySettings::RetainFreedMemory, retain);
+  prefs.endGroup();
+
+  Q_EMIT retainFreedMemoryChanged(retain);
+
+  if(retain != m_MemoryPolicy.getRetainFreedMemory())
+  {
+    QMessageBox::information(activeWindow(), tr("Keep Freed Memory"), tr("The change takes effect the next time %1 starts.").arg(QApplication::applicationName()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewApplication::isRetainFreedMemoryEnabled() const
+{
+  return m_RetainFreedMemoryEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::releaseIdleMemory(SIMPLView_UI* finishedWindow)
+{
+  if(!isAnyPipelineRunning(finishedWindow))
+  {
+    m_MemoryPolicy.releaseFreedMemory();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewApplication::isAnyPipelineRunning(SIMPLView_UI* except) const
+{
+  for(SIMPLView_UI* instance : m_SIMPLViewInstances)
+  {
+    if(instance != except && instance->isPipelineRunning())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::notifyPipelineFinished(SIMPLView_UI* finishedWindow)
+{
+  if(!isAnyPipelineRunning(finishedWindow))
+  {
+    Q_EMIT allPipelinesFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineFileIndexer* SIMPLViewApplication::getPipelineFileIndexer()
+{
+  return m_PipelineFileIndexer;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewApplication::forwardToRunningInstance()
+{
+  if(!m_SingleInstanceEnabled)
+  {
+    return false;
+  }
+
+  // The running instance may have a different working directory
+  QStringList filePaths;
+  for(const QString& filePath : m_CommandLineFilePaths)
+  {
+    filePaths.push_back(QFileInfo(filePath).absoluteFilePath());
+  }
+  return SIMPLViewInstanceServer::ForwardToRunningInstance(filePaths);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::updateInstanceServer()
+{
+  if(!m_SingleInstanceEnabled)
+  {
+    if(m_InstanceServer != nullptr)
+    {
+      m_InstanceServer->close();
+    }
+    return;
+  }
+
+  if(m_InstanceServer == nullptr)
+  {
+    m_InstanceServer = new SIMPLViewInstanceServer(this);
+    // Queued so the sending instance has been answered before any file is opened
+    connect(m_InstanceServer, &SIMPLViewInstanceServer::filesReceived, this, &SIMPLViewApplication::openForwardedFiles, Qt::QueuedConnection);
+  }
+  if(!m_InstanceServer->isListening() && !m_InstanceServer->listen())
+  {
+    qDebug() << "Another instance is already accepting files for" << SIMPLViewInstanceServer::ServerName();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::setFileOpensHeld(bool held)
+{
+  m_FileOpensHeld = held;
+  if(held || m_HeldFilePaths.isEmpty())
+  {
+    return;
+  }
+
+  QStringList filePaths = m_HeldFilePaths;
+  m_HeldFilePaths.clear();
+  openForwardedFiles(filePaths);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::openForwardedFiles(const QStringList& filePaths)
+{
+  if(m_FileOpensHeld && !filePaths.isEmpty())
+  {
+    m_HeldFilePaths.append(filePaths);
+    return;
+  }
+
+  SIMPLView_UI* ui = nullptr;
+  for(const QString& filePath : filePaths)
+  {
+    if(QFileInfo(filePath).isFile())
+    {
+      ui = newInstanceFromFile(filePath);
+    }
+  }
+
+  if(ui == nullptr)
+  {
+    ui = getNewSIMPLViewInstance();
+    ui->show();
+  }
+
+  ui->raise();
+  ui->activateWindow();
 }
 
 #ifdef SIMPL_EMBED_PYTHON
 // -----------------------------------------------------------------------------
 void SIMPLViewApplication::reloadPythonFilters()
 {
-  static const QString k_UndoStackMessageKey = "DisplayClearUndoStackMessageBox";
+  m_PendingFullPythonReload = true;
+  applyPendingPythonReload(nullptr);
+}
 
-  QtSSettings settings;
-  bool displayDialog = settings.value(k_UndoStackMessageKey, true).toBool();
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::reloadChangedPythonFilters(const QStringList& changedFiles, const QStringList& removedFiles)
+{
+  if(!m_PythonGUIEnabled)
+  {
+    return;
+  }
 
   for(SIMPLView_UI* instance : m_SIMPLViewInstances)
   {
-    if(!instance->undoStackIsClear())
+    for(const QString& filePath : changedFiles)
     {
-      int result = QMessageBox::StandardButton::Yes;
+      instance->addStdOutputMessage(QString("Python filter file \"%1\" changed").arg(filePath));
+    }
+    for(const QString& filePath : removedFiles)
+    {
+      instance->addStdOutputMessage(QString("Python filter file \"%1\" removed").arg(filePath));
+    }
+  }
 
-      if(displayDialog)
-      {
-        QCheckBox* checkBox = new QCheckBox("Do not ask me this again");
-        QMessageBox messageBox;
-        messageBox.setWindowTitle("Warning");
-        messageBox.setText("In order to reload Python filters, the undo stack must be cleared. Continue?");
-        messageBox.setIcon(QMessageBox::Icon::Warning);
-        messageBox.addButton(QMessageBox::StandardButton::No);
-        messageBox.addButton(QMessageBox::StandardButton::Yes);
-        messageBox.setDefaultButton(QMessageBox::StandardButton::No);
-        // Takes ownership
-        messageBox.setCheckBox(checkBox);
-
-        result = messageBox.exec();
-
-        displayDialog = !checkBox->isChecked();
-        settings.setValue(k_UndoStackMessageKey, displayDialog);
-      }
+  for(const QString& filePath : changedFiles)
+  {
+    m_PendingRemovedPythonFiles.remove(filePath);
+    m_PendingChangedPythonFiles.insert(filePath);
+  }
+  for(const QString& filePath : removedFiles)
+  {
+    m_PendingChangedPythonFiles.remove(filePath);
+    m_PendingRemovedPythonFiles.insert(filePath);
+  }
 
-      switch(result)
-      {
-      case QMessageBox::StandardButton::Yes:
-        instance->clearUndoStack();
-        break;
-      default:
-        return;
-      }
+  applyPendingPythonReload(nullptr);
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::retryPythonFilterReload(SIMPLView_UI* finishedWindow)
+{
+  applyPendingPythonReload(finishedWindow);
+}
+
+// -----------------------------------------------------------------------------
+bool SIMPLViewApplication::isPythonReloadBlocked(const QSet<QUuid>& uuids, SIMPLView_UI* finishedWindow) const
+{
+  for(SIMPLView_UI* instance : m_SIMPLViewInstances)
+  {
+    if(instance->isPipelineLoading())
+    {
+      return true;
+    }
+    if(instance != finishedWindow && instance->isPipelineRunning() && instance->filterUuidsInPipeline().intersects(uuids))
+    {
+      return true;
     }
   }
+  return false;
+}
 
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::applyPendingPythonReload(SIMPLView_UI* finishedWindow)
+{
   FilterManager* filterManager = FilterManager::Instance();
+  auto notifyPythonReloadDeferred = [this] {
+    if(m_PythonReloadDeferred)
+    {
+      return;
+    }
+    m_PythonReloadDeferred = true;
+    for(SIMPLView_UI* instance : m_SIMPLViewInstances)
+    {
+      instance->addStdOutputMessage("Python filters will be reloaded once no pipeline that uses them is running or being opened.");
+    }
+  };
 
-  std::vector<std::pair<SIMPLView_UI*, QJsonObject>> savedPipelines{};
+  if(m_PendingFullPythonReload)
+  {
+    QSet<QUuid> staleUuids = filterManager->pythonFilterUuids();
+    if(isPythonReloadBlocked(staleUuids, finishedWindow))
+    {
+      notifyPythonReloadDeferred();
+      return;
+    }
+
+    // A full reload also covers every file change that is still pending
+    m_PythonReloadDeferred = false;
+    m_PendingFullPythonReload = false;
+    m_PendingChangedPythonFiles.clear();
+    m_PendingRemovedPythonFiles.clear();
+
+    std::vector<std::string> paths = PythonLoader::defaultPythonFilterPaths();
+    replacePythonFilters(staleUuids, m_PythonFilterFiles.keys(), paths, staleUuids);
 
-  QSet<QUuid> pythonUuids = filterManager->pythonFilterUuids();
+    // Files held while the Python filters were not loaded yet can be opened now
+    setFileOpensHeld(false);
+
+    if(m_PythonFilterWatcher == nullptr)
+    {
+      m_PythonFilterWatcher = new PythonFilterWatcher(this);
+      connect(m_PythonFilterWatcher, &PythonFilterWatcher::filesChanged, this, &SIMPLViewApplication::reloadChangedPythonFilters);
+    }
 
+    QStringList searchPaths;
+    for(const auto& path : paths)
+    {
+      searchPaths.push_back(QString::fromStdString(path));
+    }
+    m_PythonFilterWatcher->setSearchPaths(searchPaths);
+    return;
+  }
+
+  if(m_PendingChangedPythonFiles.isEmpty() && m_PendingRemovedPythonFiles.isEmpty())
+  {
+    return;
+  }
+
+  // Only the filters defined in the changed or removed files are swapped into the pipelines
+  QSet<QUuid> changedUuids;
+  for(const QString& filePath : m_PendingChangedPythonFiles + m_PendingRemovedPythonFiles)
+  {
+    changedUuids.unite(m_PythonFilterFiles.value(filePath));
+  }
+
+  // The loader works on directories, so the directories that hold the changed files are loaded
+  // again and every factory from them is registered again. Filters from the unchanged files run
+  // the same code, so their instances stay in the pipelines.
+  QSet<QString> dirPaths;
+  for(const QString& filePath : m_PendingChangedPythonFiles)
+  {
+    dirPaths.insert(QFileInfo(filePath).absolutePath());
+  }
+
+  QStringList staleFiles = m_PendingRemovedPythonFiles.values();
+  for(auto iter = m_PythonFilterFiles.constBegin(); iter != m_PythonFilterFiles.constEnd(); ++iter)
+  {
+    if(dirPaths.contains(QFileInfo(iter.key()).absolutePath()))
+    {
+      staleFiles.push_back(iter.key());
+    }
+  }
+  staleFiles.removeDuplicates();
+
+  QSet<QUuid> staleUuids;
+  for(const QString& filePath : staleFiles)
+  {
+    staleUuids.unite(m_PythonFilterFiles.value(filePath));
+  }
+
+  if(isPythonReloadBlocked(changedUuids, finishedWindow))
+  {
+    notifyPythonReloadDeferred();
+    return;
+  }
+
+  m_PythonReloadDeferred = false;
+  m_PendingChangedPythonFiles.clear();
+  m_PendingRemovedPythonFiles.clear();
+
+  std::vector<std::string> paths;
+  for(const QString& dirPath : dirPaths)
+  {
+    paths.push_back(dirPath.toStdString());
+  }
+
+  replacePythonFilters(staleUuids, staleFiles, paths, changedUuids);
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::replacePythonFilters(const QSet<QUuid>& staleUuids, const QStringList& staleFiles, const std::vector<std::string>& dirPaths, const QSet<QUuid>& changedUuids)
+{
+  // The filters in the pipelines hold their own Python objects, so they keep working while the
+  // factories are swapped and are replaced afterwards
+  QList<SIMPLView_UI*> affectedInstances;
   for(SIMPLView_UI* instance : m_SIMPLViewInstances)
   {
-    if(std::any_of(pythonUuids.cbegin(), pythonUuids.cend(), [instance](const QUuid& uuid) { return instance->hasFilterInPipeline(uuid); }))
+    if(instance->filterUuidsInPipeline().intersects(changedUuids))
     {
-      savedPipelines.push_back({instance, instance->serializePipeline()});
-      instance->clearPipeline(false);
-      instance->clearUndoStack();
+      affectedInstances.push_back(instance);
     }
   }
 
-  for(const QUuid& uuid : pythonUuids)
+  FilterManager* filterManager = FilterManager::Instance();
+
+  for(const QUuid& uuid : staleUuids)
   {
     filterManager->removeFilterFactory(uuid);
   }
+  for(const QString& filePath : staleFiles)
+  {
+    m_PythonFilterFiles.remove(filePath);
+  }
 
   auto pythonErrorCallback = [](const std::string& message, const std::string& filePath) {
     QMessageBox messageBox;
@@ -1095,30 +1605,45 @@ void SIMPLViewApplication::reloadPythonFilters()
     messageBox.setDefaultButton(QMessageBox::StandardButton::Ok);
     messageBox.exec();
   };
-  auto pythonLoadedCallback = [this](const std::string& pyClass, const std::string& filePath) {
+  auto pythonLoadedCallback = [this, filterManager](const std::string& pyClass, const std::string& filePath) {
+    QString className = QString::fromStdString(pyClass);
+    QString absoluteFilePath = QFileInfo(QString::fromStdString(filePath)).absoluteFilePath();
+    IFilterFactory::Pointer factory = filterManager->getFactoryFromClassName(className);
+    if(factory != nullptr)
+    {
+      m_PythonFilterFiles[absoluteFilePath].insert(factory->getUuid());
+    }
+
     for(SIMPLView_UI* instance : m_SIMPLViewInstances)
     {
-      instance->addStdOutputMessage(QString("Loaded \"%1\" from \"%2\"").arg(QString::fromStdString(pyClass), QString::fromStdString(filePath)));
+      instance->addStdOutputMessage(QString("Loaded \"%1\" from \"%2\"").arg(className, absoluteFilePath));
     }
   };
-  auto paths = PythonLoader::defaultPythonFilterPaths();
-  for(SIMPLView_UI* instance : m_SIMPLViewInstances)
+
+  if(!dirPaths.empty())
   {
-    for(const auto& path : paths)
+    for(SIMPLView_UI* instance : m_SIMPLViewInstances)
     {
-      instance->addStdOutputMessage(QString("Searching \"%1\"").arg(QString::fromStdString(path)));
+      for(const auto& path : dirPaths)
+      {
+        instance->addStdOutputMessage(QString("Searching \"%1\"").arg(QString::fromStdString(path)));
+      }
     }
-  }
-  size_t numLoaded = PythonLoader::loadPythonFilters(*filterManager, paths, pythonErrorCallback, pythonLoadedCallback);
+    size_t numLoaded = PythonLoader::loadPythonFilters(*filterManager, dirPaths, pythonErrorCallback, pythonLoadedCallback);
 
-  for(SIMPLView_UI* instance : m_SIMPLViewInstances)
-  {
-    instance->addStdOutputMessage(QString("Reloaded %1 Python filters").arg(numLoaded));
+    for(SIMPLView_UI* instance : m_SIMPLViewInstances)
+    {
+      instance->addStdOutputMessage(QString("Reloaded %1 Python filters").arg(numLoaded));
+    }
   }
 
-  for(auto&& [instance, json] : savedPipelines)
+  for(SIMPLView_UI* instance : affectedInstances)
   {
-    instance->deserializePipeline(json);
+    int replacedCount = instance->replaceFilterInstances(changedUuids);
+    if(replacedCount > 0)
+    {
+      instance->addStdOutputMessage(QString("Updated %1 Python filters in the pipeline").arg(replacedCount));
+    }
   }
 
   Q_EMIT filterFactoriesUpdated();
@@ -1212,6 +1737,18 @@ void SIMPLViewApplication::createDefaultMenuBar()
 
   m_ActionClearCache = new QAction("Reset Preferences", m_DefaultMenuBar);
 
+  m_ActionThreadBudget = new QAction("Thread Budget...", m_DefaultMenuBar);
+
+  m_ActionSingleInstance = new QAction("Single Instance Mode", m_DefaultMenuBar);
+  m_ActionSingleInstance->setCheckable(true);
+  m_ActionSingleInstance->setChecked(m_SingleInstanceEnabled);
+
+  m_ActionRetainFreedMemory = new QAction("Keep Freed Memory (Takes Effect After Restart)", m_DefaultMenuBar);
+  m_ActionRetainFreedMemory->setToolTip(tr("Keeps freed blocks of up to 32 MiB in the heap for the whole session"));
+  m_ActionRetainFreedMemory->setCheckable(true);
+  m_ActionRetainFreedMemory->setChecked(m_RetainFreedMemoryEnabled);
+  m_ActionRetainFreedMemory->setEnabled(SIMPLViewMemoryPolicy::IsSupported());
+
   m_ActionShowFilterList = new QAction("Filter List", m_DefaultMenuBar);
   m_ActionShowFilterLibrary = new QAction("Filter Library", m_DefaultMenuBar);
   m_ActionShowBookmarks = new QAction("Bookmarks", m_DefaultMenuBar);
@@ -1231,6 +1768,11 @@ void SIMPLViewApplication::createDefaultMenuBar()
   connect(m_ActionShowSIMPLViewHelp, &QAction::triggered, this, &SIMPLViewApplication::listenShowSIMPLViewHelpTriggered);
   connect(m_ActionPluginInformation, &QAction::triggered, this, &SIMPLViewApplication::listenDisplayPluginInfoDialogTriggered);
   connect(m_ActionClearCache, &QAction::triggered, this, &SIMPLViewApplication::listenClearSIMPLViewCacheTriggered);
+  connect(m_ActionThreadBudget, &QAction::triggered, this, &SIMPLViewApplication::listenSetThreadBudgetTriggered);
+  connect(m_ActionSingleInstance, &QAction::triggered, this, &SIMPLViewApplication::setSingleInstanceEnabled);
+  connect(this, &SIMPLViewApplication::singleInstanceEnabledChanged, m_ActionSingleInstance, &QAction::setChecked);
+  connect(m_ActionRetainFreedMemory, &QAction::triggered, this, &SIMPLViewApplication::setRetainFreedMemory);
+  connect(this, &SIMPLViewApplication::retainFreedMemoryChanged, m_ActionRetainFreedMemory, &QAction::setChecked);
 
   m_ActionAddBookmark->setDisabled(true);
   m_ActionAddBookmarkFolder->setDisabled(true);
@@ -1322,6 +1864,9 @@ void SIMPLViewApplication::createDefaultMenuBar()
 
   m_MenuHelp->addMenu(m_MenuAdvanced);
   m_MenuAdvanced->addAction(m_ActionClearCache);
+  m_MenuAdvanced->addAction(m_ActionThreadBudget);
+  m_MenuAdvanced->addAction(m_ActionSingleInstance);
+  m_MenuAdvanced->addAction(m_ActionRetainFreedMemory);
   m_MenuAdvanced->addSeparator();
   m_MenuAdvanced->addAction(m_ActionClearBookmarks);
 
@@ -1417,3 +1962,43 @@ QMenu* SIMPLViewApplication::getRecentFilesMenu()
 {
   return m_MenuRecentFiles;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewThreadBudget* SIMPLViewApplication::getThreadBudget()
+{
+  return &m_ThreadBudget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewMemoryPolicy* SIMPLViewApplication::getMemoryPolicy()
+{
+  return &m_MemoryPolicy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterSearchIndex* SIMPLViewApplication::getFilterSearchIndex()
+{
+  return &m_FilterSearchIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterHelpCache* SIMPLViewApplication::getFilterHelpCache()
+{
+  return m_FilterHelpCache.get();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList SIMPLViewApplication::getCommandLineFilePaths() const
+{
+  return m_CommandLineFilePaths;
+}
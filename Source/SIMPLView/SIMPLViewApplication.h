@@ -35,7 +35,12 @@
 
 #pragma once
 
+#include <memory>
+
+#include <QtCore/QHash>
+#include <QtCore/QSet>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QUuid>
 
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QMenuBar>
@@ -44,6 +49,10 @@
 
 #include "SVWidgetsLib/Dialogs/UpdateCheck.h"
 
+#include "SIMPLView/FilterSearchIndex.h"
+#include "SIMPLView/SIMPLViewMemoryPolicy.h"
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
 #define dream3dApp (static_cast<SIMPLViewApplication*>(qApp))
 
 class QSplashScreen;
@@ -53,6 +62,10 @@ class ISIMPLibPlugin;
 class SIMPLViewToolbox;
 class SVPipelineFilterWidget;
 class SVPipelineViewWidget;
+class PythonFilterWatcher;
+class FilterHelpCache;
+class PipelineFileIndexer;
+class SIMPLViewInstanceServer;
 
 /**
  * @brief The SIMPLViewApplication class
@@ -121,6 +134,91 @@ public:
    */
   QMenu* getRecentFilesMenu();
 
+  /**
+   * @brief Returns the application wide thread budget that is shared by all windows
+   * @return
+   */
+  SIMPLViewThreadBudget* getThreadBudget();
+
+  /**
+   * @brief Returns the heap policy of this session
+   * @return
+   */
+  SIMPLViewMemoryPolicy* getMemoryPolicy();
+
+  /**
+   * @brief Hands retained memory back to the operating system if no pipeline other than the
+   * one in the given window is still running
+   * @param finishedWindow
+   */
+  void releaseIdleMemory(SIMPLView_UI* finishedWindow);
+
+  /**
+   * @brief Returns true if a window other than except is running its pipeline
+   * @param except
+   * @return
+   */
+  bool isAnyPipelineRunning(SIMPLView_UI* except = nullptr) const;
+
+  /**
+   * @brief Emits allPipelinesFinished() if no window other than finishedWindow is still running
+   * @param finishedWindow The window whose pipeline just finished
+   */
+  void notifyPipelineFinished(SIMPLView_UI* finishedWindow);
+
+  /**
+   * @brief Returns the background index over the bookmarked and recent pipeline files
+   * @return
+   */
+  PipelineFileIndexer* getPipelineFileIndexer();
+
+  /**
+   * @brief Returns the filter search index shared by every SIMPLView_UI window
+   * @return
+   */
+  FilterSearchIndex* getFilterSearchIndex();
+
+  /**
+   * @brief Returns the help page cache shared by every SIMPLView_UI window
+   * @return
+   */
+  FilterHelpCache* getFilterHelpCache();
+
+  /**
+   * @brief Returns true if file opens are forwarded to an already running SIMPLView
+   * @return
+   */
+  bool isSingleInstanceEnabled() const;
+
+  /**
+   * @brief Returns true if the saved preference is to keep freed memory in the heap. It only
+   * matches the memory policy once the application has been restarted.
+   * @return
+   */
+  bool isRetainFreedMemoryEnabled() const;
+
+  /**
+   * @brief In single instance mode, hands the command line files to a SIMPLView that is
+   * already running. The caller should exit when this returns true.
+   * @return true if a running instance took the files
+   */
+  bool forwardToRunningInstance();
+
+  /**
+   * @brief While held, pipeline files that the operating system or another SIMPLView asks to
+   * open are queued instead of opened. Releasing the hold opens the queued files. A full Python
+   * filter reload releases the hold when it completes.
+   * @param held
+   */
+  void setFileOpensHeld(bool held);
+
+  /**
+   * @brief Returns the file paths that were given on the command line after any
+   * thread budget options have been removed
+   * @return
+   */
+  QStringList getCommandLineFilePaths() const;
+
 #ifdef SIMPL_EMBED_PYTHON
   /**
    * @brief Enables/disables GUI elements for Python functionality based on value
@@ -132,6 +230,9 @@ public:
 
 Q_SIGNALS:
   void filterFactoriesUpdated();
+  void singleInstanceEnabledChanged(bool enabled);
+  void retainFreedMemoryChanged(bool retain);
+  void allPipelinesFinished();
 
 public Q_SLOTS:
   void listenNewInstanceTriggered();
@@ -145,8 +246,40 @@ public Q_SLOTS:
   void listenExitApplicationTriggered();
   void listenSetDataFolderTriggered();
   void listenShowDataFolderTriggered();
+  void listenSetThreadBudgetTriggered();
+
+  /**
+   * @brief Turns single instance mode on or off and saves the preference
+   * @param enabled
+   */
+  void setSingleInstanceEnabled(bool enabled);
+
+  /**
+   * @brief Saves whether freed memory is kept in the heap. The heap is only tuned at startup,
+   * so the change takes effect the next time the application starts.
+   * @param retain
+   */
+  void setRetainFreedMemory(bool retain);
 #ifdef SIMPL_EMBED_PYTHON
   void reloadPythonFilters();
+
+  /**
+   * @brief Reloads the Python filters defined in the given files. The loader works on whole
+   * directories, so every filter in a directory that holds a changed file is replaced. Only the
+   * windows that use one of those filters are rebuilt; every other window keeps its pipeline
+   * and undo history. If one of those windows is running its pipeline, the reload waits until
+   * the pipeline has finished.
+   * @param changedFiles Files that were added or edited
+   * @param removedFiles Files that were removed
+   */
+  void reloadChangedPythonFilters(const QStringList& changedFiles, const QStringList& removedFiles);
+
+  /**
+   * @brief Applies a Python filter reload that was postponed while a pipeline was running or
+   * being opened
+   * @param finishedWindow The window whose pipeline just finished, or nullptr
+   */
+  void retryPythonFilterReload(SIMPLView_UI* finishedWindow);
 #endif
 
   SIMPLView_UI* getNewSIMPLViewInstance();
@@ -173,6 +306,14 @@ protected:
   QSplashScreen* m_SplashScreen;
   QVector<QPluginLoader*> m_PluginLoaders;
 
+  SIMPLViewThreadBudget m_ThreadBudget;
+  SIMPLViewMemoryPolicy m_MemoryPolicy;
+  bool m_RetainFreedMemoryEnabled = false;
+  FilterSearchIndex m_FilterSearchIndex;
+  std::shared_ptr<FilterHelpCache> m_FilterHelpCache;
+  PipelineFileIndexer* m_PipelineFileIndexer = nullptr;
+  QStringList m_CommandLineFilePaths;
+
   /**
    * @brief loadPlugins
    * @return
@@ -196,7 +337,67 @@ protected Q_SLOTS:
    */
   void dream3dWindowChanged(SIMPLView_UI* instance);
 
+  /**
+   * @brief Opens the files forwarded by another SIMPLView process
+   * @param filePaths
+   */
+  void openForwardedFiles(const QStringList& filePaths);
+
 private:
+  SIMPLViewInstanceServer* m_InstanceServer = nullptr;
+  bool m_SingleInstanceEnabled = false;
+  bool m_FileOpensHeld = false;
+  QStringList m_HeldFilePaths;
+
+  /**
+   * @brief Separates the thread budget and instance options on the command line from the
+   * file paths
+   */
+  void parseCommandLineArguments();
+
+  /**
+   * @brief Starts or stops listening for other instances to match the current mode
+   */
+  void updateInstanceServer();
+
+#ifdef SIMPL_EMBED_PYTHON
+  PythonFilterWatcher* m_PythonFilterWatcher = nullptr;
+  // Python filter file path -> UUIDs of the filters it defines
+  QHash<QString, QSet<QUuid>> m_PythonFilterFiles;
+  QSet<QString> m_PendingChangedPythonFiles;
+  QSet<QString> m_PendingRemovedPythonFiles;
+  bool m_PendingFullPythonReload = false;
+  bool m_PythonReloadDeferred = false;
+
+  /**
+   * @brief Reloads the pending Python filter changes unless a window that uses one of the
+   * affected filters is still running its pipeline, or a window is still opening a pipeline
+   * @param finishedWindow A window whose pipeline just finished and counts as idle, or nullptr
+   */
+  void applyPendingPythonReload(SIMPLView_UI* finishedWindow);
+
+  /**
+   * @brief Returns true if the filter factories cannot be replaced yet. That is the case while
+   * a window other than finishedWindow runs a pipeline that uses one of the given filters, and
+   * while any window reads a pipeline file, because the reader looks up factories on a worker.
+   * @param uuids
+   * @param finishedWindow
+   * @return
+   */
+  bool isPythonReloadBlocked(const QSet<QUuid>& uuids, SIMPLView_UI* finishedWindow) const;
+
+  /**
+   * @brief Removes the stale Python filter factories, loads the filters found in the given
+   * directories and swaps the new filters into the pipelines in place. Pipelines and undo
+   * history are kept.
+   * @param staleUuids UUIDs of the factories being removed before the directories are loaded again
+   * @param staleFiles Python files whose filters are being replaced
+   * @param dirPaths Directories to load filters from
+   * @param changedUuids UUIDs of the filters whose code changed. Only these are replaced in the pipelines.
+   */
+  void replacePythonFilters(const QSet<QUuid>& staleUuids, const QStringList& staleFiles, const std::vector<std::string>& dirPaths, const QSet<QUuid>& changedUuids);
+#endif
+
   QMenuBar* m_DefaultMenuBar = nullptr;
   QMenu* m_DockMenu = nullptr;
 
@@ -228,6 +429,9 @@ private:
   QAction* m_ActionCheckForUpdates = nullptr;
   QAction* m_ActionPluginInformation = nullptr;
   QAction* m_ActionClearCache = nullptr;
+  QAction* m_ActionThreadBudget = nullptr;
+  QAction* m_ActionSingleInstance = nullptr;
+  QAction* m_ActionRetainFreedMemory = nullptr;
 
   QAction* m_ActionCut = nullptr;
   QAction* m_ActionCopy = nullptr;
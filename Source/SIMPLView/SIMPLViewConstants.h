@@ -49,4 +49,27 @@ static const QString LastVersionCheck("LastVersionCheck");
 static const QString WhenToCheck("WhenToCheck");
 static const QString UpdateWebSite("http://dream3d.bluequartz.net/dream3d_version.json");
 } // namespace UpdateWebsite
+
+namespace ThreadSettings
+{
+static const QString GroupName("Application Settings");
+static const QString MaximumThreads("Maximum Threads");
+static const QString CpuAffinity("CPU Affinity");
+static const QString MaxThreadsArgument("--max-threads");
+static const QString CpuAffinityArgument("--cpu-affinity");
+} // namespace ThreadSettings
+
+namespace InstanceSettings
+{
+static const QString GroupName("Application Settings");
+static const QString SingleInstance("Single Instance");
+static const QString SingleInstanceArgument("--single-instance");
+static const QString NewInstanceArgument("--new-instance");
+} // namespace InstanceSettings
+
+namespace MemorySettings
+{
+static const QString GroupName("Application Settings");
+static const QString RetainFreedMemory("Retain Freed Memory");
+} // namespace MemorySettings
 } // namespace SIMPLView
@@ -0,0 +1,183 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLViewInstanceServer.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+
+namespace
+{
+const char k_Acknowledgement = 'A';
+const int k_ConnectTimeout = 100;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewInstanceServer::SIMPLViewInstanceServer(QObject* parent)
+: QObject(parent)
+, m_Server(new QLocalServer(this))
+{
+  // Only the user that started SIMPLView may connect
+  m_Server->setSocketOptions(QLocalServer::UserAccessOption);
+  connect(m_Server, &QLocalServer::newConnection, this, &SIMPLViewInstanceServer::handleNewConnection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewInstanceServer::~SIMPLViewInstanceServer() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SIMPLViewInstanceServer::ServerName()
+{
+  // Socket names live in a shared namespace, so make them unique per user
+  QByteArray userHash = QCryptographicHash::hash(QDir::homePath().toUtf8(), QCryptographicHash::Sha1).toHex().left(12);
+  return QString("%1-%2").arg(QCoreApplication::applicationName(), QString::fromLatin1(userHash));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewInstanceServer::ForwardToRunningInstance(const QStringList& filePaths, int timeout)
+{
+  QLocalSocket socket;
+  socket.connectToServer(ServerName());
+  if(!socket.waitForConnected(k_ConnectTimeout))
+  {
+    return false;
+  }
+
+  QByteArray message;
+  QDataStream out(&message, QIODevice::WriteOnly);
+  out << filePaths;
+  if(socket.write(message) != message.size() || !socket.waitForBytesWritten(timeout))
+  {
+    return false;
+  }
+
+  // Once the message has been written the running instance will read it, even if it is too
+  // busy to answer right away. Starting a second instance now would open the files twice, so
+  // a missing or late acknowledgement is not treated as a failure.
+  if(socket.waitForReadyRead(timeout))
+  {
+    char reply = 0;
+    socket.getChar(&reply);
+  }
+  socket.disconnectFromServer();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewInstanceServer::listen()
+{
+  QString serverName = ServerName();
+  if(m_Server->listen(serverName))
+  {
+    return true;
+  }
+
+  if(m_Server->serverError() != QAbstractSocket::AddressInUseError)
+  {
+    return false;
+  }
+
+  // Another instance started at the same time and is already serving
+  QLocalSocket probe;
+  probe.connectToServer(serverName);
+  if(probe.waitForConnected(k_ConnectTimeout))
+  {
+    probe.abort();
+    return false;
+  }
+
+  QLocalServer::removeServer(serverName);
+  return m_Server->listen(serverName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewInstanceServer::close()
+{
+  m_Server->close();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewInstanceServer::isListening() const
+{
+  return m_Server->isListening();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewInstanceServer::handleNewConnection()
+{
+  while(m_Server->hasPendingConnections())
+  {
+    QLocalSocket* socket = m_Server->nextPendingConnection();
+    connect(socket, &QLocalSocket::disconnected, socket, &QLocalSocket::deleteLater);
+    connect(socket, &QLocalSocket::readyRead, this, [this, socket] {
+      QDataStream in(socket);
+      in.startTransaction();
+      QStringList filePaths;
+      in >> filePaths;
+      if(!in.commitTransaction())
+      {
+        // Wait for the rest of the message
+        return;
+      }
+
+      // Answer before anything else is done with the files
+      socket->putChar(k_Acknowledgement);
+      socket->flush();
+      socket->disconnectFromServer();
+
+      Q_EMIT filesReceived(filePaths);
+    });
+  }
+}
@@ -0,0 +1,111 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+
+class QLocalServer;
+
+/**
+ * @brief The SIMPLViewInstanceServer class lets a newly launched SIMPLView hand its files to a
+ * SIMPLView that is already running instead of loading every plugin again. The running process
+ * listens on a local socket that is private to the user; a new process connects, sends its file
+ * paths and exits as soon as the running process acknowledges them.
+ */
+class SIMPLViewInstanceServer : public QObject
+{
+  Q_OBJECT
+
+public:
+  SIMPLViewInstanceServer(QObject* parent = nullptr);
+  ~SIMPLViewInstanceServer() override;
+
+  /**
+   * @brief Returns the name of the local socket for this application and user
+   * @return
+   */
+  static QString ServerName();
+
+  /**
+   * @brief Sends the file paths to a running instance
+   * @param filePaths
+   * @param timeout Milliseconds to wait for the write and for the acknowledgement
+   * @return true if the files were written to a running instance. Only a failure to connect or
+   * to write returns false; the acknowledgement is not required.
+   */
+  static bool ForwardToRunningInstance(const QStringList& filePaths, int timeout = 1000);
+
+  /**
+   * @brief Starts listening for other instances. A socket left behind by a crashed instance
+   * is removed, but one that still answers is left alone.
+   * @return
+   */
+  bool listen();
+
+  /**
+   * @brief Stops listening
+   */
+  void close();
+
+  /**
+   * @brief Returns true while listening
+   * @return
+   */
+  bool isListening() const;
+
+Q_SIGNALS:
+  /**
+   * @brief Emitted when another instance forwarded its file paths
+   * @param filePaths Absolute paths; empty if the other instance was started without files
+   */
+  void filesReceived(const QStringList& filePaths);
+
+protected Q_SLOTS:
+  /**
+   * @brief Reads the file paths from a connecting instance
+   */
+  void handleNewConnection();
+
+private:
+  QLocalServer* m_Server = nullptr;
+
+public:
+  SIMPLViewInstanceServer(const SIMPLViewInstanceServer&) = delete;            // Copy Constructor Not Implemented
+  SIMPLViewInstanceServer(SIMPLViewInstanceServer&&) = delete;                 // Move Constructor Not Implemented
+  SIMPLViewInstanceServer& operator=(const SIMPLViewInstanceServer&) = delete; // Copy Assignment Not Implemented
+  SIMPLViewInstanceServer& operator=(SIMPLViewInstanceServer&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,118 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLViewMemoryPolicy.h"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+#if defined(__GLIBC__)
+// glibc will not raise the mmap threshold past 32 MiB on 64 bit systems. Fixing it there keeps
+// every block up to that size in the heap, where a later filter can reuse it. Larger blocks are
+// always mapped directly.
+constexpr int k_RetainedMmapThreshold = 32 * 1024 * 1024;
+constexpr int k_RetainedTrimThreshold = 1024 * 1024 * 1024;
+constexpr int k_RetainedTopPad = 64 * 1024 * 1024;
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewMemoryPolicy::SIMPLViewMemoryPolicy() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewMemoryPolicy::~SIMPLViewMemoryPolicy() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewMemoryPolicy::IsSupported()
+{
+#if defined(__GLIBC__)
+  return true;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewMemoryPolicy::retainFreedMemory()
+{
+  if(m_RetainFreedMemory)
+  {
+    return true;
+  }
+
+#if defined(__GLIBC__)
+  // mallopt() returns 1 on success
+  bool ok = true;
+  ok = mallopt(M_MMAP_THRESHOLD, k_RetainedMmapThreshold) == 1 && ok;
+  ok = mallopt(M_TRIM_THRESHOLD, k_RetainedTrimThreshold) == 1 && ok;
+  ok = mallopt(M_TOP_PAD, k_RetainedTopPad) == 1 && ok;
+  m_RetainFreedMemory = true;
+  return ok;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewMemoryPolicy::getRetainFreedMemory() const
+{
+  return m_RetainFreedMemory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewMemoryPolicy::releaseFreedMemory()
+{
+#if defined(__GLIBC__)
+  if(m_RetainFreedMemory)
+  {
+    malloc_trim(0);
+  }
+#endif
+}
@@ -0,0 +1,88 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+/**
+ * @brief The SIMPLViewMemoryPolicy class tunes how the process heap hands memory back to the
+ * operating system. Pipelines free and reallocate arrays of the same size from one filter to
+ * the next. By default glibc returns large freed blocks to the kernel, and the next filter
+ * page-faults its way through fresh memory. When freed memory is retained, blocks of up to
+ * 32 MiB stay in the heap. Larger arrays are still mapped and unmapped by the kernel.
+ *
+ * The policy is applied once at startup and holds for the rest of the session. It cannot be
+ * undone, because setting any of the thresholds turns off glibc's dynamic mmap threshold for
+ * good. After each run, retained memory is returned once no pipeline is running.
+ */
+class SIMPLViewMemoryPolicy
+{
+public:
+  SIMPLViewMemoryPolicy();
+  ~SIMPLViewMemoryPolicy();
+
+  /**
+   * @brief Returns true if the C runtime allows the heap to be tuned. Only glibc does.
+   * @return
+   */
+  static bool IsSupported();
+
+  /**
+   * @brief Keeps freed blocks of up to 32 MiB in the heap for reuse by later filters instead
+   * of returning them to the operating system. Call this once, before any pipeline runs.
+   * @return False if the heap could not be tuned on this platform
+   */
+  bool retainFreedMemory();
+
+  /**
+   * @brief Returns true if freed blocks are kept in the heap for this session
+   * @return
+   */
+  bool getRetainFreedMemory() const;
+
+  /**
+   * @brief Returns the retained memory to the operating system. Call this once no pipeline
+   * is running.
+   */
+  void releaseFreedMemory();
+
+private:
+  bool m_RetainFreedMemory = false;
+
+public:
+  SIMPLViewMemoryPolicy(const SIMPLViewMemoryPolicy&) = delete;            // Copy Constructor Not Implemented
+  SIMPLViewMemoryPolicy(SIMPLViewMemoryPolicy&&) = delete;                 // Move Constructor Not Implemented
+  SIMPLViewMemoryPolicy& operator=(const SIMPLViewMemoryPolicy&) = delete; // Copy Assignment Not Implemented
+  SIMPLViewMemoryPolicy& operator=(SIMPLViewMemoryPolicy&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,255 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLViewThreadBudget.h"
+
+#include <algorithm>
+
+#if defined(Q_OS_LINUX)
+#include <sched.h>
+#include <unistd.h>
+#elif defined(Q_OS_WIN)
+#include <windows.h>
+#endif
+
+#include <QtCore/QDebug>
+#include <QtCore/QStringList>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewThreadBudget::SIMPLViewThreadBudget() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLViewThreadBudget::~SIMPLViewThreadBudget() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLViewThreadBudget::IdealThreadCount()
+{
+  return std::max(QThread::idealThreadCount(), 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLViewThreadBudget::CpuCount()
+{
+#if defined(Q_OS_LINUX)
+  long cpuCount = sysconf(_SC_NPROCESSORS_CONF);
+  return cpuCount > 0 ? static_cast<int>(cpuCount) : IdealThreadCount();
+#elif defined(Q_OS_WIN)
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  return std::max(static_cast<int>(systemInfo.dwNumberOfProcessors), 1);
+#else
+  return IdealThreadCount();
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QThreadPool* SIMPLViewThreadBudget::ApplicationPool()
+{
+  static QThreadPool pool;
+  return &pool;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<int> SIMPLViewThreadBudget::ParseCpuList(const QString& cpuList, int cpuCount, bool* ok)
+{
+  QVector<int> cpus;
+  bool valid = true;
+
+  const QStringList ranges = cpuList.split(',', QString::SkipEmptyParts);
+  for(const QString& range : ranges)
+  {
+    QStringList bounds = range.trimmed().split('-');
+    bool firstOk = false;
+    bool lastOk = false;
+    int first = bounds.front().toInt(&firstOk);
+    int last = bounds.back().toInt(&lastOk);
+    // Check the bounds before expanding the range so a huge range cannot fill the list
+    if(bounds.size() > 2 || !firstOk || !lastOk || first < 0 || last < first || last >= cpuCount)
+    {
+      valid = false;
+      break;
+    }
+    for(int cpu = first; cpu <= last; cpu++)
+    {
+      cpus.push_back(cpu);
+    }
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+
+  if(ok != nullptr)
+  {
+    *ok = valid;
+  }
+  return valid ? cpus : QVector<int>();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewThreadBudget::setMaxThreadCount(int maxThreads)
+{
+  m_MaxThreadCount = std::max(maxThreads, 0);
+  applyThreadCount();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLViewThreadBudget::getMaxThreadCount() const
+{
+  return m_MaxThreadCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLViewThreadBudget::getEffectiveThreadCount() const
+{
+  int available = m_AffinityCpuCount > 0 ? m_AffinityCpuCount : IdealThreadCount();
+  if(m_MaxThreadCount > 0)
+  {
+    return std::min(m_MaxThreadCount, available);
+  }
+  return available;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLViewThreadBudget::setCpuAffinity(const QString& cpuList)
+{
+  bool ok = false;
+  QVector<int> cpus = ParseCpuList(cpuList, CpuCount(), &ok);
+  if(!ok)
+  {
+    qDebug() << "Invalid CPU affinity list:" << cpuList;
+    return false;
+  }
+
+  if(cpus.isEmpty())
+  {
+    // Allow the process to run on every core again
+    for(int cpu = 0; cpu < CpuCount(); cpu++)
+    {
+      cpus.push_back(cpu);
+    }
+  }
+
+#if defined(Q_OS_LINUX)
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  for(int cpu : cpus)
+  {
+    if(cpu < CPU_SETSIZE)
+    {
+      CPU_SET(cpu, &cpuSet);
+    }
+  }
+  if(sched_setaffinity(0, sizeof(cpu_set_t), &cpuSet) != 0)
+  {
+    qDebug() << "Could not set the CPU affinity to" << cpuList;
+    return false;
+  }
+#elif defined(Q_OS_WIN)
+  DWORD_PTR mask = 0;
+  for(int cpu : cpus)
+  {
+    if(cpu < static_cast<int>(sizeof(DWORD_PTR) * 8))
+    {
+      mask |= (static_cast<DWORD_PTR>(1) << cpu);
+    }
+  }
+  if(mask == 0 || SetProcessAffinityMask(GetCurrentProcess(), mask) == 0)
+  {
+    qDebug() << "Could not set the CPU affinity to" << cpuList;
+    return false;
+  }
+#else
+  // macOS does not allow a process to be pinned to a set of cores
+  if(!cpuList.trimmed().isEmpty())
+  {
+    qDebug() << "CPU affinity is not supported on this platform.";
+    return false;
+  }
+#endif
+
+  m_CpuAffinity = cpuList.trimmed();
+  m_AffinityCpuCount = m_CpuAffinity.isEmpty() ? 0 : cpus.size();
+  applyThreadCount();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SIMPLViewThreadBudget::getCpuAffinity() const
+{
+  return m_CpuAffinity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewThreadBudget::applyThreadCount()
+{
+  int threadCount = getEffectiveThreadCount();
+  QThreadPool::globalInstance()->setMaxThreadCount(threadCount);
+
+#if SIMPL_USE_PARALLEL_ALGORITHMS
+  // Only one global_control of a given kind may be the active one, so drop the old limit first.
+  // The limit applies to every task arena in the process which makes it shared by all windows.
+  m_GlobalControl.reset();
+  if(m_MaxThreadCount > 0 || m_AffinityCpuCount > 0)
+  {
+    m_GlobalControl = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, static_cast<size_t>(threadCount));
+  }
+#endif
+}
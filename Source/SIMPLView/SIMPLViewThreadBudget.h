@@ -0,0 +1,147 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+class QThreadPool;
+
+#include "SIMPLib/SIMPLib.h"
+
+#if SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/global_control.h>
+#endif
+
+/**
+ * @brief The SIMPLViewThreadBudget class holds the application wide limit on the number of
+ * worker threads. Every SIMPLView_UI window, every running pipeline and every TBB parallel
+ * algorithm draws from the same budget, so several concurrent pipelines no longer launch one
+ * full set of threads each.
+ */
+class SIMPLViewThreadBudget
+{
+public:
+  SIMPLViewThreadBudget();
+  ~SIMPLViewThreadBudget();
+
+  /**
+   * @brief Returns the number of logical cores available to the process
+   * @return
+   */
+  static int IdealThreadCount();
+
+  /**
+   * @brief Returns the number of CPUs configured on the system, regardless of the CPU affinity
+   * of the process. Valid CPU indices run from zero up to this count.
+   * @return
+   */
+  static int CpuCount();
+
+  /**
+   * @brief Returns the thread pool for SIMPLView's own background work such as loading pipeline
+   * files, array statistics, searches and the Python filter watcher. The thread budget only limits
+   * the global pool that pipelines run on, so this work stays responsive while a budget is set.
+   * @return
+   */
+  static QThreadPool* ApplicationPool();
+
+  /**
+   * @brief Parses a CPU list of the form "0-7,16,18-19" into individual CPU indices
+   * @param cpuList
+   * @param cpuCount CPU indices at or above this count are rejected
+   * @param ok Set to false if the list could not be parsed
+   * @return
+   */
+  static QVector<int> ParseCpuList(const QString& cpuList, int cpuCount, bool* ok = nullptr);
+
+  /**
+   * @brief Sets the maximum number of worker threads. A value of zero (or less) removes the
+   * limit and lets the thread pools use one thread per available core.
+   * @param maxThreads
+   */
+  void setMaxThreadCount(int maxThreads);
+
+  /**
+   * @brief Returns the requested maximum number of worker threads. Zero means unlimited.
+   * @return
+   */
+  int getMaxThreadCount() const;
+
+  /**
+   * @brief Returns the number of worker threads that are actually allowed, taking the
+   * CPU affinity set into account.
+   * @return
+   */
+  int getEffectiveThreadCount() const;
+
+  /**
+   * @brief Restricts the process to the given CPU list. An empty list clears the restriction.
+   * Threads created after this call inherit the affinity, so this should be applied before
+   * any pipeline is executed.
+   * @param cpuList
+   * @return False if the list is invalid or the platform does not support CPU affinity
+   */
+  bool setCpuAffinity(const QString& cpuList);
+
+  /**
+   * @brief Returns the CPU list the process is restricted to
+   * @return
+   */
+  QString getCpuAffinity() const;
+
+private:
+  int m_MaxThreadCount = 0;
+  QString m_CpuAffinity;
+  int m_AffinityCpuCount = 0;
+
+#if SIMPL_USE_PARALLEL_ALGORITHMS
+  std::unique_ptr<tbb::global_control> m_GlobalControl;
+#endif
+
+  /**
+   * @brief Pushes the effective thread count into the Qt and TBB thread pools
+   */
+  void applyThreadCount();
+
+public:
+  SIMPLViewThreadBudget(const SIMPLViewThreadBudget&) = delete;            // Copy Constructor Not Implemented
+  SIMPLViewThreadBudget(SIMPLViewThreadBudget&&) = delete;                 // Move Constructor Not Implemented
+  SIMPLViewThreadBudget& operator=(const SIMPLViewThreadBudget&) = delete; // Copy Assignment Not Implemented
+  SIMPLViewThreadBudget& operator=(SIMPLViewThreadBudget&&) = delete;      // Move Assignment Not Implemented
+};
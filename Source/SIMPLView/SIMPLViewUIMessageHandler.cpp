@@ -35,21 +35,18 @@
 
 #include "SIMPLViewUIMessageHandler.h"
 
-#include <QtCore/QTextStream>
-
 #include "SIMPLib/Messages/FilterProgressMessage.h"
 #include "SIMPLib/Messages/FilterStatusMessage.h"
 #include "SIMPLib/Messages/PipelineProgressMessage.h"
 #include "SIMPLib/Messages/PipelineStatusMessage.h"
 
-#include "SIMPLView/SIMPLView_UI.h"
-#include "SVWidgetsLib/Widgets/SVStyle.h"
+#include "SIMPLView/PipelineMessageQueue.h"
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-SIMPLViewUIMessageHandler::SIMPLViewUIMessageHandler(SIMPLView_UI* uiWidget)
-: m_UIWidget(uiWidget)
+SIMPLViewUIMessageHandler::SIMPLViewUIMessageHandler(PipelineMessageQueue* messageQueue)
+: m_MessageQueue(messageQueue)
 {
 }
 
@@ -59,14 +56,7 @@ SIMPLViewUIMessageHandler::SIMPLViewUIMessageHandler(SIMPLView_UI* uiWidget)
 void SIMPLViewUIMessageHandler::processMessage(const FilterStatusMessage* msg) const
 {
   QString statusMessage = msg->generateMessageString();
-
-  if(nullptr != m_UIWidget->statusBar())
-  {
-    m_UIWidget->statusBar()->showMessage(statusMessage);
-  }
-
-  statusMessage.prepend("      ");
-  appendStatusMessageToPipelineOutput(statusMessage);
+  m_MessageQueue->pushStatusMessage(statusMessage, QString("      ") + statusMessage);
 }
 
 // -----------------------------------------------------------------------------
@@ -74,8 +64,7 @@ void SIMPLViewUIMessageHandler::processMessage(const FilterStatusMessage* msg) c
 // -----------------------------------------------------------------------------
 void SIMPLViewUIMessageHandler::processMessage(const PipelineProgressMessage* msg) const
 {
-  float progValue = static_cast<float>(msg->getProgressValue()) / 100;
-  m_UIWidget->m_Ui->pipelineListWidget->setProgressValue(progValue);
+  m_MessageQueue->pushProgress(msg->getProgressValue());
 }
 
 // -----------------------------------------------------------------------------
@@ -84,35 +73,5 @@ void SIMPLViewUIMessageHandler::processMessage(const PipelineProgressMessage* ms
 void SIMPLViewUIMessageHandler::processMessage(const PipelineStatusMessage* msg) const
 {
   QString statusMessage = msg->generateMessageString();
-
-  if(nullptr != m_UIWidget->statusBar())
-  {
-    m_UIWidget->statusBar()->showMessage(statusMessage);
-  }
-
-  appendStatusMessageToPipelineOutput(statusMessage);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void SIMPLViewUIMessageHandler::appendStatusMessageToPipelineOutput(const QString& statusMessage) const
-{
-  // Allow status messages to open the standard output widget
-  if(SIMPLView::DockWidgetSettings::HideDockSetting::OnStatusAndError == StandardOutputWidget::GetHideDockSetting())
-  {
-    m_UIWidget->m_Ui->stdOutDockWidget->setVisible(true);
-  }
-
-  // Allow status messages to open the issuesDockWidget as well
-  if(SIMPLView::DockWidgetSettings::HideDockSetting::OnStatusAndError == IssuesWidget::GetHideDockSetting())
-  {
-    m_UIWidget->m_Ui->issuesDockWidget->setVisible(true);
-  }
-
-  //  QString text;
-  //  QTextStream ts(&text);
-  //  ts << "<a style=\"color: " << SVStyle::Instance()->getQLabel_color().name(QColor::HexRgb) << ";\" >" << statusMessage << "</span>";
-
-  m_UIWidget->m_Ui->stdOutWidget->appendText(statusMessage);
+  m_MessageQueue->pushStatusMessage(statusMessage, statusMessage);
 }
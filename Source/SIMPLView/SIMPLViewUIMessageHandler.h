@@ -37,45 +37,38 @@
 
 #include "SIMPLib/Messages/AbstractMessageHandler.h"
 
-class SIMPLView_UI;
-class AbstractStatusMessage;
+class PipelineMessageQueue;
 
 /**
- * @brief This message handler is used by SIMPLView_UI to display filter and pipeline status messages in the status bar
- * and in the Pipeline Output dock widget.  It is also used to display pipeline progress in the progress bar.
+ * @brief This message handler is used by SIMPLView_UI to queue filter and pipeline status messages for the status bar
+ * and the Pipeline Output dock widget, as well as pipeline progress for the progress bar.  It may run on the pipeline's
+ * worker thread, so it only touches the PipelineMessageQueue; the SIMPLView_UI drains the queue on the GUI thread.
  */
 class SIMPLViewUIMessageHandler : public AbstractMessageHandler
 {
 public:
-  explicit SIMPLViewUIMessageHandler(SIMPLView_UI* uiWidget);
+  explicit SIMPLViewUIMessageHandler(PipelineMessageQueue* messageQueue);
 
   /**
-   * @brief Sets the SIMPLView_UI status bar and appends the standard output widget with
-   * incoming FilterStatusMessage's status message.
+   * @brief Queues the incoming FilterStatusMessage's status message for the status bar and
+   * the standard output widget.
    * @param msg
    */
   void processMessage(const FilterStatusMessage* msg) const override;
 
   /**
-   * @brief Sets the SIMPLView_UI progress bar with the incoming PipelineProgressMessage's
-   * progress value.
+   * @brief Queues the incoming PipelineProgressMessage's progress value for the progress bar.
    * @param msg
    */
   void processMessage(const PipelineProgressMessage* msg) const override;
 
   /**
-   * @brief Sets the SIMPLView_UI status bar and appends the standard output widget with
-   * incoming PipelineStatusMessage's status message.
+   * @brief Queues the incoming PipelineStatusMessage's status message for the status bar and
+   * the standard output widget.
    * @param msg
    */
   void processMessage(const PipelineStatusMessage* msg) const override;
 
 private:
-  SIMPLView_UI* m_UIWidget = nullptr;
-
-  /**
-   * @brief processStatusMessage
-   * @param msg
-   */
-  void appendStatusMessageToPipelineOutput(const QString& statusMessage) const;
+  PipelineMessageQueue* m_MessageQueue = nullptr;
 };
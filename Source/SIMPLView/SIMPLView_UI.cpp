@@ -38,15 +38,22 @@
 #include <algorithm>
 
 //-- Qt Includes
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/QTimer>
 #include <QtCore/QUrl>
 #include <QtGui/QCloseEvent>
 #include <QtGui/QDesktopServices>
 #include <QtWidgets/QFileDialog>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QPushButton>
 #include <QtWidgets/QShortcut>
+#include <QtWidgets/QTreeView>
 
 //-- SIMPLView Includes
 #include <QtCore/QDebug>
@@ -69,10 +76,12 @@
 #include "SVWidgetsLib/Widgets/BookmarksToolboxWidget.h"
 #include "SVWidgetsLib/Widgets/BookmarksTreeView.h"
 #include "SVWidgetsLib/Widgets/FilterLibraryToolboxWidget.h"
+#include "SVWidgetsLib/Widgets/IssuesWidget.h"
 #include "SVWidgetsLib/Widgets/PipelineItemDelegate.h"
 #include "SVWidgetsLib/Widgets/PipelineListWidget.h"
 #include "SVWidgetsLib/Widgets/PipelineModel.h"
 #include "SVWidgetsLib/Widgets/SVStyle.h"
+#include "SVWidgetsLib/Widgets/StandardOutputWidget.h"
 #include "SVWidgetsLib/Widgets/StatusBarWidget.h"
 #include "SVWidgetsLib/Widgets/util/AddFilterCommand.h"
 
@@ -90,14 +99,32 @@
 #endif
 
 #include "SIMPLView/AboutSIMPLView.h"
+#include "SIMPLView/ArrayValuesDialog.h"
+#include "SIMPLView/FilterHelpCache.h"
+#include "SIMPLView/FilterHelpDialog.h"
+#include "SIMPLView/FilterQuickFindDialog.h"
+#include "SIMPLView/PipelineFileIndexer.h"
+#include "SIMPLView/PipelineSearchDialog.h"
+#include "SIMPLView/DataBrowserState.h"
 #include "SIMPLView/SIMPLView.h"
 #include "SIMPLView/SIMPLViewApplication.h"
 #include "SIMPLView/SIMPLViewConstants.h"
+#include "SIMPLView/SIMPLViewThreadBudget.h"
 #include "SIMPLView/SIMPLViewUIMessageHandler.h"
 #include "SIMPLView/SIMPLViewVersion.h"
 
 #include "BrandedStrings.h"
 
+namespace
+{
+// Pipeline messages are shown at most this often (in milliseconds), roughly 30 updates per second
+constexpr int k_MessageFlushInterval = 33;
+
+// Moving between parameter widgets ends one requirement and starts the next. Clearing the data
+// browser is held back this long (in milliseconds) so equal requirements keep their highlight.
+constexpr int k_ClearViewDelay = 150;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -148,6 +175,11 @@ SIMPLView_UI::~SIMPLView_UI()
 {
   writeSettings();
 
+  if(m_PipelineRunRecorded)
+  {
+    PipelineFileLoader::EndPipelineRun();
+  }
+
   dream3dApp->unregisterSIMPLViewWindow(this);
 
   if(dream3dApp->activeWindow() == this)
@@ -182,6 +214,12 @@ void SIMPLView_UI::listenSavePipelineTriggered()
 // -----------------------------------------------------------------------------
 bool SIMPLView_UI::savePipeline()
 {
+  // The window does not show the file it is opening yet
+  if(isPipelineLoading())
+  {
+    return false;
+  }
+
   QString filePath;
   if(windowFilePath().isEmpty())
   {
@@ -223,6 +261,11 @@ void SIMPLView_UI::listenSavePipelineAsTriggered()
 // -----------------------------------------------------------------------------
 bool SIMPLView_UI::savePipelineAs()
 {
+  if(isPipelineLoading())
+  {
+    return false;
+  }
+
   QString proposedFile = m_LastOpenedFilePath + QDir::separator() + "Untitled.json";
   QString filePath = QFileDialog::getSaveFileName(this, tr("Save Pipeline To File"), proposedFile, tr("Json File (*.json);;SIMPLView File (*.dream3d);;All Files (*.*)"));
   if(filePath.isEmpty())
@@ -285,19 +328,20 @@ bool SIMPLView_UI::savePipelineAs()
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::activateBookmark(const QString& filePath, bool execute)
 {
+  // A window that is still opening another pipeline only looks empty, so it gets a new window as well
   SIMPLView_UI* instance = dream3dApp->getActiveInstance();
-  if(instance != nullptr && !instance->isWindowModified() && instance->getPipelineModel()->isEmpty())
+  if(instance == nullptr || instance->isWindowModified() || !instance->getPipelineModel()->isEmpty() || instance->isPipelineLoading())
   {
-    instance->openPipeline(filePath);
+    instance = dream3dApp->getNewSIMPLViewInstance();
+    instance->show();
   }
-  else
+
+  // The file is added to the recent files list once it has been read successfully
+  if(instance->openPipeline(QDir::toNativeSeparators(filePath)) < 0)
   {
-    instance = dream3dApp->newInstanceFromFile(filePath);
+    return;
   }
 
-  QtSRecentFileList* list = QtSRecentFileList::Instance();
-  list->addFile(filePath);
-
   if(execute)
   {
     instance->executePipeline();
@@ -491,9 +535,36 @@ void SIMPLView_UI::setupGui()
 
   viewWidget->setModel(model);
 
-  // Set the IssuesWidget as a PipelineMessageObserver Object.
+  // Set the PipelineIssuesWidget as a PipelineMessageObserver Object.
   viewWidget->addPipelineMessageObserver(m_Ui->issuesWidget);
 
+  // Pipeline messages are queued as they arrive and shown in batches by this timer
+  m_MessageFlushTimer = new QTimer(this);
+  m_MessageFlushTimer->setSingleShot(true);
+  m_MessageFlushTimer->setInterval(k_MessageFlushInterval);
+  connect(m_MessageFlushTimer, &QTimer::timeout, this, &SIMPLView_UI::flushPipelineMessages);
+
+  m_ClearViewTimer = new QTimer(this);
+  m_ClearViewTimer->setSingleShot(true);
+  m_ClearViewTimer->setInterval(k_ClearViewDelay);
+  connect(m_ClearViewTimer, &QTimer::timeout, this, &SIMPLView_UI::applyClearViewRequirements);
+
+  m_PipelineLoadWatcher = new QFutureWatcher<PipelineFileLoader::Result>(this);
+  connect(m_PipelineLoadWatcher, &QFutureWatcher<PipelineFileLoader::Result>::finished, this, &SIMPLView_UI::pipelineLoadFinished);
+  connect(dream3dApp, &SIMPLViewApplication::allPipelinesFinished, this, &SIMPLView_UI::startDeferredPipelineLoad);
+
+  // Shown while a .dream3d file waits for the running pipelines before it is opened
+  m_DeferredLoadWidget = new QWidget(this);
+  QHBoxLayout* deferredLoadLayout = new QHBoxLayout(m_DeferredLoadWidget);
+  deferredLoadLayout->setContentsMargins(0, 0, 0, 0);
+  m_DeferredLoadLabel = new QLabel(m_DeferredLoadWidget);
+  QPushButton* cancelDeferredLoadBtn = new QPushButton(tr("Cancel"), m_DeferredLoadWidget);
+  connect(cancelDeferredLoadBtn, &QPushButton::clicked, this, &SIMPLView_UI::cancelDeferredPipelineLoad);
+  deferredLoadLayout->addWidget(m_DeferredLoadLabel);
+  deferredLoadLayout->addWidget(cancelDeferredLoadBtn);
+  statusBar()->addPermanentWidget(m_DeferredLoadWidget);
+  m_DeferredLoadWidget->hide();
+
   createSIMPLViewMenuSystem();
 
   // Hook up the signals from the various docks to the PipelineViewWidget that will either add a filter
@@ -512,6 +583,8 @@ void SIMPLView_UI::setupGui()
 
   m_Ui->filterListDockWidget->raise();
 
+  splitDockWidget(m_Ui->dataBrowserDockWidget, m_Ui->arrayStatisticsDockWidget, Qt::Vertical);
+
   // Shortcut to close the window
   new QShortcut(QKeySequence(QKeySequence::Close), this, SLOT(close()));
 
@@ -530,12 +603,12 @@ void SIMPLView_UI::setupGui()
 
   //  connect(m_Ui->issuesWidget, SIGNAL(tableHasErrors(bool, int, int)), m_StatusBar, SLOT(issuesTableHasErrors(bool, int, int)));
   connect(m_Ui->issuesWidget, SIGNAL(tableHasErrors(bool, int, int)), this, SLOT(issuesTableHasErrors(bool, int, int)));
-  connect(m_Ui->issuesWidget, SIGNAL(showTable(bool)), m_Ui->issuesDockWidget, SLOT(setVisible(bool)));
   connect(dream3dApp, &SIMPLViewApplication::filterFactoriesUpdated, m_Ui->filterListWidget, &FilterListToolboxWidget::loadFilterList);
   connect(dream3dApp, &SIMPLViewApplication::filterFactoriesUpdated, m_Ui->filterLibraryWidget, &FilterLibraryToolboxWidget::refreshFilterGroups);
 
   connectDockWidgetSignalsSlots(m_Ui->bookmarksDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->dataBrowserDockWidget);
+  connectDockWidgetSignalsSlots(m_Ui->arrayStatisticsDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->filterLibraryDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->filterListDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->issuesDockWidget);
@@ -544,6 +617,7 @@ void SIMPLView_UI::setupGui()
 
   m_Ui->bookmarksDockWidget->installEventFilter(this);
   m_Ui->dataBrowserDockWidget->installEventFilter(this);
+  m_Ui->arrayStatisticsDockWidget->installEventFilter(this);
   m_Ui->filterLibraryDockWidget->installEventFilter(this);
   m_Ui->filterListDockWidget->installEventFilter(this);
   m_Ui->issuesDockWidget->installEventFilter(this);
@@ -599,6 +673,18 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
   m_ActionCheckForUpdates = new QAction("Check For Updates", this);
   m_ActionPluginInformation = new QAction("Plugin Information", this);
   m_ActionClearCache = new QAction("Reset Preferences", this);
+  m_ActionThreadBudget = new QAction("Thread Budget...", this);
+  m_ActionSingleInstance = new QAction("Single Instance Mode", this);
+  m_ActionSingleInstance->setCheckable(true);
+  m_ActionSingleInstance->setChecked(dream3dApp->isSingleInstanceEnabled());
+  m_ActionRetainFreedMemory = new QAction("Keep Freed Memory (Takes Effect After Restart)", this);
+  m_ActionRetainFreedMemory->setToolTip(tr("Keeps freed blocks of up to 32 MiB in the heap for the whole session"));
+  m_ActionRetainFreedMemory->setCheckable(true);
+  m_ActionRetainFreedMemory->setChecked(dream3dApp->isRetainFreedMemoryEnabled());
+  m_ActionRetainFreedMemory->setEnabled(SIMPLViewMemoryPolicy::IsSupported());
+  m_ActionInspectArrayValues = new QAction("Inspect Array Values...", this);
+  m_ActionFindPipelines = new QAction("Find Pipelines...", this);
+  m_ActionQuickAddFilter = new QAction("Quick Add Filter...", this);
 
   // SIMPLView_UI Actions
   connect(m_ActionNew, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenNewInstanceTriggered);
@@ -612,6 +698,38 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
   connect(m_ActionShowSIMPLViewHelp, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenShowSIMPLViewHelpTriggered);
   connect(m_ActionPluginInformation, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenDisplayPluginInfoDialogTriggered);
   connect(m_ActionClearCache, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenClearSIMPLViewCacheTriggered);
+  connect(m_ActionThreadBudget, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenSetThreadBudgetTriggered);
+  connect(m_ActionSingleInstance, &QAction::triggered, dream3dApp, &SIMPLViewApplication::setSingleInstanceEnabled);
+  connect(dream3dApp, &SIMPLViewApplication::singleInstanceEnabledChanged, m_ActionSingleInstance, &QAction::setChecked);
+  connect(m_ActionRetainFreedMemory, &QAction::triggered, dream3dApp, &SIMPLViewApplication::setRetainFreedMemory);
+  connect(dream3dApp, &SIMPLViewApplication::retainFreedMemoryChanged, m_ActionRetainFreedMemory, &QAction::setChecked);
+  connect(m_ActionInspectArrayValues, &QAction::triggered, [=] {
+    QTreeView* dataBrowserTreeView = m_Ui->dataBrowserWidget->findChild<QTreeView*>();
+    if(dataBrowserTreeView != nullptr)
+    {
+      showArrayValues(dataBrowserTreeView->currentIndex());
+    }
+  });
+  connect(m_ActionFindPipelines, &QAction::triggered, [=] {
+    if(m_PipelineSearchDialog == nullptr)
+    {
+      m_PipelineSearchDialog = new PipelineSearchDialog(dream3dApp->getPipelineFileIndexer(), this);
+      connect(m_PipelineSearchDialog, &PipelineSearchDialog::pipelineActivated, [=](const QString& filePath) { activateBookmark(filePath, false); });
+    }
+    m_PipelineSearchDialog->show();
+    m_PipelineSearchDialog->raise();
+    m_PipelineSearchDialog->activateWindow();
+  });
+  connect(m_ActionQuickAddFilter, &QAction::triggered, [=] {
+    if(m_FilterQuickFindDialog == nullptr)
+    {
+      m_FilterQuickFindDialog = new FilterQuickFindDialog(dream3dApp->getFilterSearchIndex(), this);
+      connect(m_FilterQuickFindDialog, &FilterQuickFindDialog::filterSelected, [=](const QString& className) { m_Ui->pipelineListWidget->getPipelineView()->addFilterFromClassName(className); });
+    }
+    m_FilterQuickFindDialog->show();
+    m_FilterQuickFindDialog->raise();
+    m_FilterQuickFindDialog->activateWindow();
+  });
 
   m_ActionNew->setShortcut(QKeySequence::New);
   m_ActionOpen->setShortcut(QKeySequence::Open);
@@ -621,6 +739,8 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
   m_ActionCheckForUpdates->setShortcut(QKeySequence(Qt::CTRL + Qt::Key_U));
   m_ActionShowSIMPLViewHelp->setShortcut(QKeySequence(Qt::CTRL + Qt::Key_H));
   m_ActionPluginInformation->setShortcut(QKeySequence(Qt::CTRL + Qt::Key_I));
+  m_ActionFindPipelines->setShortcut(QKeySequence(Qt::CTRL + Qt::SHIFT + Qt::Key_F));
+  m_ActionQuickAddFilter->setShortcut(QKeySequence(Qt::CTRL + Qt::SHIFT + Qt::Key_A));
 
   // Pipeline View Actions
   SVPipelineView* viewWidget = m_Ui->pipelineListWidget->getPipelineView();
@@ -679,16 +799,22 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
   m_MenuView->addAction(m_Ui->issuesDockWidget->toggleViewAction());
   m_MenuView->addAction(m_Ui->stdOutDockWidget->toggleViewAction());
   m_MenuView->addAction(m_Ui->dataBrowserDockWidget->toggleViewAction());
+  m_MenuView->addAction(m_Ui->arrayStatisticsDockWidget->toggleViewAction());
+  m_MenuView->addSeparator();
+  m_MenuView->addAction(m_ActionInspectArrayValues);
 
   // Create Bookmarks Menu
   m_SIMPLViewMenu->addMenu(m_MenuBookmarks);
   m_MenuBookmarks->addAction(actionAddBookmark);
   m_MenuBookmarks->addSeparator();
   m_MenuBookmarks->addAction(actionNewFolder);
+  m_MenuBookmarks->addSeparator();
+  m_MenuBookmarks->addAction(m_ActionFindPipelines);
 
   // Create Pipeline Menu
   m_SIMPLViewMenu->addMenu(m_MenuPipeline);
   m_MenuPipeline->addAction(actionClearPipeline);
+  m_MenuPipeline->addAction(m_ActionQuickAddFilter);
 #ifdef SIMPL_EMBED_PYTHON
   m_ActionReloadPython = new QAction("Reload Python Filters", this);
   m_ActionReloadPython->setShortcut(QKeySequence(Qt::CTRL + Qt::Key_R));
@@ -707,6 +833,9 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
 
   m_MenuHelp->addMenu(m_MenuAdvanced);
   m_MenuAdvanced->addAction(m_ActionClearCache);
+  m_MenuAdvanced->addAction(m_ActionThreadBudget);
+  m_MenuAdvanced->addAction(m_ActionSingleInstance);
+  m_MenuAdvanced->addAction(m_ActionRetainFreedMemory);
   m_MenuAdvanced->addSeparator();
   m_MenuAdvanced->addAction(actionClearBookmarks);
 
@@ -764,23 +893,31 @@ void SIMPLView_UI::connectSignalsSlots()
   /* Pipeline View Connections */
   connect(pipelineView->selectionModel(), &QItemSelectionModel::selectionChanged, this, &SIMPLView_UI::filterSelectionChanged);
   connect(pipelineView, &SVPipelineView::filterParametersChanged, [=](AbstractFilter::Pointer filter) {
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    activateDataBrowserFilter(filter);
     markDocumentAsDirty();
   });
-  connect(pipelineView, &SVPipelineView::clearDataStructureWidgetTriggered, [=] { m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer()); });
+  connect(pipelineView, &SVPipelineView::clearDataStructureWidgetTriggered, [=] { activateDataBrowserFilter(AbstractFilter::NullPointer()); });
   connect(pipelineView, &SVPipelineView::filterInputWidgetNeedsCleared, this, &SIMPLView_UI::clearFilterInputWidget);
-  connect(pipelineView, &SVPipelineView::displayIssuesTriggered, m_Ui->issuesWidget, &IssuesWidget::displayCachedMessages);
-  connect(pipelineView, &SVPipelineView::clearIssuesTriggered, m_Ui->issuesWidget, &IssuesWidget::clearIssues);
+  connect(pipelineView, &SVPipelineView::displayIssuesTriggered, m_Ui->issuesWidget, &PipelineIssuesWidget::displayCachedMessages);
+  connect(pipelineView, &SVPipelineView::clearIssuesTriggered, m_Ui->issuesWidget, &PipelineIssuesWidget::clearIssues);
   connect(pipelineView, &SVPipelineView::writeSIMPLViewSettingsTriggered, [=] { writeSettings(); });
 
   // Connection that displays issues in the Issue Table when the preflight is finished
   connect(pipelineView, &SVPipelineView::preflightFinished, [=](int32_t pipelineFilterCount, int err) {
-    m_Ui->dataBrowserWidget->refreshData();
+    refreshDataBrowser();
     m_Ui->issuesWidget->displayCachedMessages();
     m_Ui->pipelineListWidget->preflightFinished(pipelineFilterCount, err);
   });
 
-  connect(pipelineView, &SVPipelineView::pipelineHasMessage, this, &SIMPLView_UI::processPipelineMessage);
+  // A direct connection avoids posting one queued event to the GUI thread per message. The handler runs on
+  // the pipeline's thread, so it only gets the queue and the flush timer and never this window.
+  PipelineMessageQueue* messageQueue = &m_PipelineMessageQueue;
+  QTimer* messageFlushTimer = m_MessageFlushTimer;
+  connect(pipelineView, &SVPipelineView::pipelineHasMessage, this,
+          [messageQueue, messageFlushTimer](const AbstractMessage::Pointer& msg) { QueuePipelineMessage(messageQueue, messageFlushTimer, msg); }, Qt::DirectConnection);
+  // The Start button runs the pipeline through the view, so the run is tracked from its signals.
+  // pipelineStarted is emitted on the GUI thread before the pipeline's worker thread starts.
+  connect(pipelineView, &SVPipelineView::pipelineStarted, this, &SIMPLView_UI::pipelineDidStart, Qt::DirectConnection);
   connect(pipelineView, &SVPipelineView::pipelineFinished, this, &SIMPLView_UI::pipelineDidFinish);
   connect(pipelineView, &SVPipelineView::pipelineFilePathUpdated, this, &SIMPLView_UI::setWindowFilePath);
 
@@ -796,6 +933,44 @@ void SIMPLView_UI::connectSignalsSlots()
   connect(pipelineModel, &PipelineModel::standardOutputMessageGenerated, [=](const QString& msg) { addStdOutputMessage(msg); });
 
   connect(pipelineModel, &PipelineModel::pipelineDataChanged, [=] {});
+
+  // The filter UUID index follows the rows that change. Only a reset rebuilds it, on the next query.
+  connect(pipelineModel, &PipelineModel::rowsInserted, [=](const QModelIndex& parent, int first, int last) {
+    if(!parent.isValid())
+    {
+      filterUuidRowsInserted(first, last);
+    }
+  });
+  connect(pipelineModel, &PipelineModel::rowsRemoved, [=](const QModelIndex& parent, int first, int last) {
+    if(!parent.isValid())
+    {
+      filterUuidRowsRemoved(first, last);
+    }
+  });
+  connect(pipelineModel, &PipelineModel::rowsMoved, [=](const QModelIndex& parent, int start, int end, const QModelIndex& destination, int row) {
+    if(!parent.isValid() && !destination.isValid())
+    {
+      filterUuidRowsMoved(start, end, row);
+    }
+  });
+  connect(pipelineModel, &PipelineModel::dataChanged, [=](const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& roles) {
+    // Parameter edits, selection borders and error states name their roles. Only a change
+    // without roles can have replaced the filter of a row.
+    if(roles.isEmpty() && !topLeft.parent().isValid())
+    {
+      filterUuidRowsChanged(topLeft.row(), bottomRight.row());
+    }
+  });
+  connect(pipelineModel, &PipelineModel::modelReset, [=] { m_FilterUuidIndexDirty = true; });
+
+  /* Data Browser Connections */
+  QTreeView* dataBrowserTreeView = m_Ui->dataBrowserWidget->findChild<QTreeView*>();
+  if(dataBrowserTreeView != nullptr)
+  {
+    connect(dataBrowserTreeView, &QTreeView::clicked, this, &SIMPLView_UI::dataBrowserItemSelected);
+    connect(dataBrowserTreeView, &QTreeView::activated, this, &SIMPLView_UI::dataBrowserItemSelected);
+    connect(dataBrowserTreeView, &QTreeView::doubleClicked, this, &SIMPLView_UI::showArrayValues);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -826,24 +1001,235 @@ void SIMPLView_UI::showDockWidget(QDockWidget* dockWidget)
 // -----------------------------------------------------------------------------
 int SIMPLView_UI::openPipeline(const QString& filePath)
 {
+  if(isPipelineLoading())
+  {
+    statusBar()->showMessage(tr("Another pipeline is still being opened in this window."));
+    return -1;
+  }
+
+  QFileInfo fi(filePath);
+  if(!fi.isFile() || !fi.isReadable())
+  {
+    QMessageBox::critical(this, tr("Open Pipeline"), tr("The pipeline file '%1' does not exist or cannot be read.").arg(QDir::toNativeSeparators(filePath)), QMessageBox::Ok);
+    return -2;
+  }
+
+  // Edits and saving are blocked until the file is read, so the loaded filters do not mix with
+  // new edits. The window title and file path are only set once the file has been read.
+  setPipelineEditsBlocked(true);
+
+  // Running pipelines use HDF5 on their own threads, so .dream3d files wait until they have finished
+  if(fi.suffix().compare("dream3d", Qt::CaseInsensitive) == 0 && dream3dApp->isAnyPipelineRunning())
+  {
+    m_DeferredLoadFilePath = filePath;
+    m_DeferredLoadLabel->setText(tr("Waiting for the running pipelines to finish before opening '%1'").arg(fi.fileName()));
+    m_DeferredLoadWidget->show();
+    return 0;
+  }
+
+  startPipelineLoad(filePath);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::startPipelineLoad(const QString& filePath)
+{
+  statusBar()->showMessage(tr("Opening '%1'...").arg(QFileInfo(filePath).fileName()));
+
+  // Parsing the file and creating the filters happens on a worker so the window stays responsive
+  QThread* guiThread = thread();
+  m_PipelineLoadWatcher->setFuture(QtConcurrent::run(SIMPLViewThreadBudget::ApplicationPool(), [filePath, guiThread] { return PipelineFileLoader::Load(filePath, guiThread); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::startDeferredPipelineLoad()
+{
+  if(m_DeferredLoadFilePath.isEmpty())
+  {
+    return;
+  }
+
+  QString filePath = m_DeferredLoadFilePath;
+  m_DeferredLoadFilePath.clear();
+  m_DeferredLoadWidget->hide();
+  startPipelineLoad(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::cancelDeferredPipelineLoad()
+{
+  if(m_DeferredLoadFilePath.isEmpty())
+  {
+    return;
+  }
+
+  QString fileName = QFileInfo(m_DeferredLoadFilePath).fileName();
+  m_DeferredLoadFilePath.clear();
+  m_ExecuteAfterLoad = false;
+  m_DeferredLoadWidget->hide();
+  setPipelineEditsBlocked(false);
+  statusBar()->showMessage(tr("Opening '%1' was canceled.").arg(fileName));
+
+#ifdef SIMPL_EMBED_PYTHON
+  // A Python filter reload that waited for this window can run now
+  dream3dApp->retryPythonFilterReload(nullptr);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::setPipelineEditsBlocked(bool blocked)
+{
+  if(blocked == m_PipelineEditsBlocked)
+  {
+    return;
+  }
+  m_PipelineEditsBlocked = blocked;
+
+  // The view, its Start button and drops onto it
+  m_Ui->pipelineListWidget->setEnabled(!blocked);
+
+  // Double clicks in the filter list and library add filters to the view. A running pipeline
+  // unblocks them itself when it finishes.
+  if(blocked || !isPipelineRunning())
+  {
+    m_Ui->filterListWidget->blockSignals(blocked);
+    m_Ui->filterLibraryWidget->blockSignals(blocked);
+  }
+
+  // Actions keep working from the menus and shortcuts while the view is disabled
   SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
-  int err = pipelineView->openPipeline(filePath);
-  if(err >= 0)
+  if(blocked)
+  {
+    QList<QAction*> actions = {m_ActionSave,
+                               m_ActionSaveAs,
+                               m_ActionQuickAddFilter,
+                               pipelineView->getActionPaste(),
+                               pipelineView->getActionClearPipeline(),
+                               pipelineView->getActionUndo(),
+                               pipelineView->getActionRedo()};
+    for(QAction* action : actions)
+    {
+      m_ActionStatesBeforeLoad.insert(action, action->isEnabled());
+      action->setEnabled(false);
+    }
+  }
+  else
   {
-    PipelineModel* model = pipelineView->getPipelineModel();
-    if(model->rowCount() > 0)
+    for(auto iter = m_ActionStatesBeforeLoad.cbegin(); iter != m_ActionStatesBeforeLoad.cend(); ++iter)
     {
-      QModelIndex index = model->index(0, PipelineItem::PipelineItemData::Contents);
-      pipelineView->selectionModel()->select(index, QItemSelectionModel::ClearAndSelect);
+      iter.key()->setEnabled(iter.value());
     }
+    m_ActionStatesBeforeLoad.clear();
   }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLView_UI::isPipelineLoading() const
+{
+  return m_PipelineLoadWatcher->isRunning() || !m_DeferredLoadFilePath.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::pipelineLoadFinished()
+{
+  setPipelineEditsBlocked(false);
+
+  PipelineFileLoader::Result result = m_PipelineLoadWatcher->result();
+  if(result.pipeline.get() == nullptr)
+  {
+    showPipelineLoadMessages(result.messages);
+    m_ExecuteAfterLoad = false;
+    statusBar()->showMessage(result.errorMessage);
+    addStdOutputMessage(result.errorMessage);
+    QMessageBox::critical(this, tr("Open Pipeline"), result.errorMessage, QMessageBox::Ok);
+#ifdef SIMPL_EMBED_PYTHON
+    dream3dApp->retryPythonFilterReload(nullptr);
+#endif
+    return;
+  }
+
+  // Edits were blocked during the load, so these are filters the window already held
+  SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
+  QFileInfo fi(result.filePath);
+  if(!pipelineView->getPipelineModel()->isEmpty())
+  {
+    QMessageBox::StandardButton answer = QMessageBox::question(this, tr("Open Pipeline"), tr("This window already holds a pipeline. Replace it with the pipeline from '%1'?").arg(fi.fileName()),
+                                                               QMessageBox::Yes | QMessageBox::No, QMessageBox::No);
+    if(answer != QMessageBox::Yes)
+    {
+      m_ExecuteAfterLoad = false;
+      statusBar()->showMessage(tr("'%1' was not opened.").arg(fi.fileName()));
+#ifdef SIMPL_EMBED_PYTHON
+      dream3dApp->retryPythonFilterReload(nullptr);
+#endif
+      return;
+    }
+    pipelineView->clearPipeline(false);
+  }
+
+  // Every filter is added at once so the pipeline is preflighted a single time, as soon as it is complete
+  auto filterContainer = result.pipeline->getFilterContainer();
+  std::vector<AbstractFilter::Pointer> filters(filterContainer.cbegin(), filterContainer.cend());
+  pipelineView->addFilters(filters);
+  pipelineView->clearUndoStack();
+
+  PipelineModel* model = pipelineView->getPipelineModel();
+  if(model->rowCount() > 0)
+  {
+    QModelIndex index = model->index(0, PipelineItem::PipelineItemData::Contents);
+    pipelineView->selectionModel()->select(index, QItemSelectionModel::ClearAndSelect);
+  }
+
+  // Shown after the filters are added, because their preflight resets the issues table
+  showPipelineLoadMessages(result.messages);
 
-  QFileInfo fi(filePath);
   setWindowTitle(QString("[*]") + fi.baseName() + " - " + QApplication::applicationName());
-  setWindowFilePath(filePath);
+  setWindowFilePath(result.filePath);
+  m_LastOpenedFilePath = result.filePath;
   setWindowModified(false);
+  statusBar()->showMessage(tr("Opened '%1'").arg(fi.fileName()));
+  QtSRecentFileList::Instance()->addFile(result.filePath);
+
+#ifdef SIMPL_EMBED_PYTHON
+  // A Python filter reload that waited for this file to be read and added can replace the factories now
+  dream3dApp->retryPythonFilterReload(nullptr);
+#endif
+
+  if(m_ExecuteAfterLoad)
+  {
+    m_ExecuteAfterLoad = false;
+    executePipeline();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::showPipelineLoadMessages(const QVector<AbstractMessage::Pointer>& messages)
+{
+  if(messages.isEmpty())
+  {
+    return;
+  }
 
-  return err;
+  for(const AbstractMessage::Pointer& msg : messages)
+  {
+    m_Ui->issuesWidget->processPipelineMessage(msg);
+    addStdOutputMessage(msg->generateMessageString());
+  }
+  m_Ui->issuesWidget->displayCachedMessages();
 }
 
 // -----------------------------------------------------------------------------
@@ -863,11 +1249,11 @@ void SIMPLView_UI::handlePipelineChanges()
     PipelineModel* model = getPipelineModel();
 
     AbstractFilter::Pointer filter = model->filter(selectedIndex);
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    activateDataBrowserFilter(filter);
   }
   else
   {
-    m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer());
+    activateDataBrowserFilter(AbstractFilter::NullPointer());
   }
 }
 
@@ -876,9 +1262,23 @@ void SIMPLView_UI::handlePipelineChanges()
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::executePipeline()
 {
+  if(isPipelineLoading())
+  {
+    m_ExecuteAfterLoad = true;
+    return;
+  }
+
   m_Ui->pipelineListWidget->getPipelineView()->executePipeline();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLView_UI::isPipelineRunning()
+{
+  return m_Ui->pipelineListWidget->getPipelineView()->isPipelineCurrentlyRunning();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -929,10 +1329,77 @@ void SIMPLView_UI::populateMenus(QObject* plugin)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void SIMPLView_UI::processPipelineMessage(const AbstractMessage::Pointer& msg)
+void SIMPLView_UI::QueuePipelineMessage(PipelineMessageQueue* messageQueue, QTimer* flushTimer, const AbstractMessage::Pointer& msg)
 {
-  SIMPLViewUIMessageHandler msgHandler(this);
+  SIMPLViewUIMessageHandler msgHandler(messageQueue);
   msg->visit(&msgHandler);
+
+  // Only the first message after a flush schedules the next one
+  if(messageQueue->requestFlush())
+  {
+    QMetaObject::invokeMethod(flushTimer, "start", Qt::QueuedConnection);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::flushPipelineMessages()
+{
+  PipelineMessageQueue::Batch batch = m_PipelineMessageQueue.takeBatch();
+
+  if(!batch.statusMessage.isEmpty() && nullptr != statusBar())
+  {
+    statusBar()->showMessage(batch.statusMessage);
+  }
+
+  if(batch.progress >= 0)
+  {
+    float progValue = static_cast<float>(batch.progress) / 100;
+    m_Ui->pipelineListWidget->setProgressValue(progValue);
+  }
+
+  if(batch.outputLines.isEmpty())
+  {
+    return;
+  }
+
+  // Allow status messages to open the standard output widget
+  if(SIMPLView::DockWidgetSettings::HideDockSetting::OnStatusAndError == StandardOutputWidget::GetHideDockSetting())
+  {
+    m_Ui->stdOutDockWidget->setVisible(true);
+  }
+
+  // Allow status messages to open the issuesDockWidget as well
+  if(SIMPLView::DockWidgetSettings::HideDockSetting::OnStatusAndError == IssuesWidget::GetHideDockSetting())
+  {
+    m_Ui->issuesDockWidget->setVisible(true);
+  }
+
+  m_Ui->stdOutWidget->appendText(batch.outputLines.join('\n'));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::pipelineDidStart()
+{
+  // No .dream3d file is read by SIMPLView while the pipeline uses HDF5
+  if(!m_PipelineRunRecorded)
+  {
+    m_PipelineRunRecorded = true;
+    PipelineFileLoader::BeginPipelineRun();
+  }
+
+  // This waits for the statistics worker to stop
+  m_Ui->arrayStatisticsWidget->setPipelineRunning(true);
+
+  // The values dialogs read the arrays whenever they repaint, so they are closed. Deleting a
+  // dialog waits for its search to stop.
+  for(ArrayValuesDialog* dialog : findChildren<ArrayValuesDialog*>())
+  {
+    delete dialog;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -940,6 +1407,29 @@ void SIMPLView_UI::processPipelineMessage(const AbstractMessage::Pointer& msg)
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::pipelineDidFinish()
 {
+  // Show anything that is still waiting in the message queue before reporting the end of the pipeline
+  m_MessageFlushTimer->stop();
+  flushPipelineMessages();
+
+  size_t mergedCount = m_PipelineMessageQueue.getMergedMessageCount();
+  if(mergedCount > 0)
+  {
+    addStdOutputMessage(tr("%1 of %2 pipeline messages were merged into earlier messages.").arg(mergedCount).arg(m_PipelineMessageQueue.getReceivedMessageCount()));
+  }
+  m_PipelineMessageQueue.resetCounters();
+
+  // The statistics of the previous run no longer describe the arrays
+  m_Ui->arrayStatisticsWidget->setPipelineRunning(false);
+
+  if(m_PipelineRunRecorded)
+  {
+    m_PipelineRunRecorded = false;
+    PipelineFileLoader::EndPipelineRun();
+  }
+
+  // Arrays kept in the heap for reuse by later filters are no longer needed
+  dream3dApp->releaseIdleMemory(this);
+
   // Re-enable FilterListToolboxWidget signals - resume adding filters
   m_Ui->filterListWidget->blockSignals(false);
 
@@ -955,14 +1445,22 @@ void SIMPLView_UI::pipelineDidFinish()
     PipelineModel* model = getPipelineModel();
 
     AbstractFilter::Pointer filter = model->filter(selectedIndex);
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    activateDataBrowserFilter(filter);
   }
   else
   {
-    m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer());
+    activateDataBrowserFilter(AbstractFilter::NullPointer());
   }
 
   m_Ui->pipelineListWidget->pipelineFinished();
+
+#ifdef SIMPL_EMBED_PYTHON
+  // Python filter changes saved while this pipeline ran can be applied now
+  dream3dApp->retryPythonFilterReload(this);
+#endif
+
+  // Files that wait for HDF5 to be free can be read once no pipeline is running
+  dream3dApp->notifyPipelineFinished(this);
 }
 
 // -----------------------------------------------------------------------------
@@ -973,6 +1471,10 @@ void SIMPLView_UI::showFilterHelp(const QString& className)
 // Launch the dialog
 #if(defined(SIMPL_USE_MKDOCS) || defined(SIMPL_USE_DISCOUNT))
   QUrl helpURL = URL_GENERATOR::GenerateHTMLUrl(className);
+  if(showEmbeddedHelp(helpURL, className))
+  {
+    return;
+  }
   bool didOpen = QDesktopServices::openUrl(helpURL);
   if(!didOpen)
   {
@@ -995,6 +1497,10 @@ void SIMPLView_UI::showFilterHelp(const QString& className)
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::showFilterHelpUrl(const QUrl& helpURL)
 {
+  if(showEmbeddedHelp(helpURL))
+  {
+    return;
+  }
   bool didOpen = QDesktopServices::openUrl(helpURL);
   if(!didOpen)
   {
@@ -1008,6 +1514,53 @@ void SIMPLView_UI::showFilterHelpUrl(const QUrl& helpURL)
   }
 }
 
+// -----------------------------------------------------------------------------
+bool SIMPLView_UI::showEmbeddedHelp(const QUrl& url, const QString& className)
+{
+  if(!url.isLocalFile())
+  {
+    return false;
+  }
+
+  FilterHelpCache* helpCache = dream3dApp->getFilterHelpCache();
+  if(m_FilterHelpDialog == nullptr)
+  {
+    m_FilterHelpDialog = new FilterHelpDialog(helpCache, this);
+  }
+
+  if(QFileInfo(url.toLocalFile()).isFile())
+  {
+    m_FilterHelpDialog->showUrl(url);
+  }
+  else if(!className.isEmpty())
+  {
+    m_FilterHelpDialog->showHtml(className, FilterHelpCache::FallbackHtml(className));
+  }
+  else
+  {
+    return false;
+  }
+
+  m_FilterHelpDialog->show();
+  m_FilterHelpDialog->raise();
+  m_FilterHelpDialog->activateWindow();
+
+  // The other filters in this pipeline are the pages most likely to be asked for next
+  QList<QUrl> urls;
+  PipelineModel* model = getPipelineModel();
+  for(int i = 0; i < model->rowCount(); i++)
+  {
+    AbstractFilter::Pointer filter = model->filter(model->index(i, PipelineItem::Contents));
+    if(filter.get() != nullptr && filter->getNameOfClass() != className)
+    {
+      urls.push_back(FilterHelpCache::FilterHelpUrl(filter->getNameOfClass()));
+    }
+  }
+  helpCache->prefetch(urls);
+
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1016,6 +1569,168 @@ DataStructureWidget* SIMPLView_UI::getDataStructureWidget()
   return m_Ui->dataBrowserWidget;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::activateDataBrowserFilter(const AbstractFilter::Pointer& filter)
+{
+  // Updating the index is the only walk over the data structure; it also tells whether the tree changed
+  bool structureChanged = m_DataArrayPathIndex.update(filter.get() != nullptr ? filter->getDataContainerArray() : DataContainerArray::NullPointer());
+  if(filter == m_DataBrowserFilter && !structureChanged)
+  {
+    return;
+  }
+
+  DataBrowserState state;
+  QTreeView* treeView = m_Ui->dataBrowserWidget->findChild<QTreeView*>();
+  state.save(treeView);
+  m_Ui->dataBrowserWidget->filterActivated(filter);
+  state.restore(treeView);
+
+  m_DataBrowserFilter = filter;
+  dataBrowserRebuilt();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::refreshDataBrowser()
+{
+  if(!m_DataArrayPathIndex.update(m_DataBrowserFilter.get() != nullptr ? m_DataBrowserFilter->getDataContainerArray() : DataContainerArray::NullPointer()))
+  {
+    return;
+  }
+
+  DataBrowserState state;
+  QTreeView* treeView = m_Ui->dataBrowserWidget->findChild<QTreeView*>();
+  state.save(treeView);
+  m_Ui->dataBrowserWidget->refreshData();
+  state.restore(treeView);
+
+  dataBrowserRebuilt();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::dataBrowserRebuilt()
+{
+  // The items of the old tree are gone, so the current requirement is matched and highlighted again
+  m_DataBrowserHighlighter.reset();
+  m_ViewedPathsValid = false;
+  if(m_ViewedPathsQuery)
+  {
+    showViewedPaths(m_ViewedPathsQuery);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::showViewedPaths(const std::function<QVector<DataArrayPath>()>& query)
+{
+  // A pending clear is dropped when another requirement is shown
+  m_ClearViewTimer->stop();
+  m_ViewedPathsQuery = query;
+
+  // The highlight only depends on the paths, so requirements that match the same paths leave the tree alone
+  QVector<DataArrayPath> paths = query();
+  if(m_ViewedPathsValid && paths == m_ViewedPaths)
+  {
+    return;
+  }
+
+  m_ViewedPaths = paths;
+  m_ViewedPathsValid = true;
+  m_DataBrowserHighlighter.highlight(m_Ui->dataBrowserWidget->findChild<QTreeView*>(), paths);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::viewPathsMatchingReqs(DataContainerSelectionFilterParameter::RequirementType dcReqs)
+{
+  showViewedPaths([this, dcReqs]() { return m_DataArrayPathIndex.findDataContainers(dcReqs); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::viewPathsMatchingReqs(AttributeMatrixSelectionFilterParameter::RequirementType amReqs)
+{
+  showViewedPaths([this, amReqs]() { return m_DataArrayPathIndex.findAttributeMatrices(amReqs); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::viewPathsMatchingReqs(DataArraySelectionFilterParameter::RequirementType daReqs)
+{
+  showViewedPaths([this, daReqs]() { return m_DataArrayPathIndex.findDataArrays(daReqs); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::clearViewRequirements()
+{
+  if(m_ViewedPathsQuery)
+  {
+    m_ClearViewTimer->start();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::applyClearViewRequirements()
+{
+  m_ViewedPathsQuery = nullptr;
+  m_ViewedPaths.clear();
+  m_ViewedPathsValid = false;
+  m_DataBrowserHighlighter.clear(m_Ui->dataBrowserWidget->findChild<QTreeView*>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::dataBrowserItemSelected(const QModelIndex& index)
+{
+  DataArrayPath path = DataBrowserState::CreateDataArrayPath(index);
+  if(path.getDataArrayName().isEmpty() || m_DataBrowserFilter.get() == nullptr)
+  {
+    m_Ui->arrayStatisticsWidget->setArray(QString(), IDataArray::NullPointer());
+    return;
+  }
+
+  IDataArray::Pointer array = DataBrowserState::FindDataArray(m_DataBrowserFilter, path);
+  m_Ui->arrayStatisticsWidget->setArray(path.serialize("/"), array);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::showArrayValues(const QModelIndex& index)
+{
+  if(isPipelineRunning())
+  {
+    statusBar()->showMessage(tr("Array values are not available while the pipeline is running."));
+    return;
+  }
+
+  DataArrayPath path = DataBrowserState::CreateDataArrayPath(index);
+  IDataArray::Pointer array = DataBrowserState::FindDataArray(m_DataBrowserFilter, path);
+  if(array.get() == nullptr)
+  {
+    statusBar()->showMessage(tr("Select an attribute array in the Data Structure to inspect its values."));
+    return;
+  }
+
+  ArrayValuesDialog* dialog = new ArrayValuesDialog(path.serialize("/"), array, this);
+  dialog->setAttribute(Qt::WA_DeleteOnClose);
+  dialog->show();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1048,12 +1763,12 @@ void SIMPLView_UI::filterSelectionChanged(const QItemSelection& selected, const
     setFilterInputWidget(fiw);
 
     AbstractFilter::Pointer filter = model->filter(selectedIndex);
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    activateDataBrowserFilter(filter);
   }
   else
   {
     clearFilterInputWidget();
-    m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer());
+    activateDataBrowserFilter(AbstractFilter::NullPointer());
   }
 }
 
@@ -1077,14 +1792,15 @@ void SIMPLView_UI::setFilterInputWidget(FilterInputWidget* widget)
   // Clear the filter input widget
   clearFilterInputWidget();
 
-  // Alert to DataArrayPath requirements
-  connect(widget, SIGNAL(viewPathsMatchingReqs(DataContainerSelectionFilterParameter::RequirementType)), getDataStructureWidget(),
-          SLOT(setViewReqs(DataContainerSelectionFilterParameter::RequirementType)), Qt::ConnectionType::UniqueConnection);
-  connect(widget, SIGNAL(viewPathsMatchingReqs(AttributeMatrixSelectionFilterParameter::RequirementType)), getDataStructureWidget(),
-          SLOT(setViewReqs(AttributeMatrixSelectionFilterParameter::RequirementType)), Qt::ConnectionType::UniqueConnection);
-  connect(widget, SIGNAL(viewPathsMatchingReqs(DataArraySelectionFilterParameter::RequirementType)), getDataStructureWidget(), SLOT(setViewReqs(DataArraySelectionFilterParameter::RequirementType)),
+  // Alert to DataArrayPath requirements. These are matched against the DataArrayPathIndex and
+  // only the items of the matching paths are highlighted in the data browser.
+  connect(widget, SIGNAL(viewPathsMatchingReqs(DataContainerSelectionFilterParameter::RequirementType)), this, SLOT(viewPathsMatchingReqs(DataContainerSelectionFilterParameter::RequirementType)),
+          Qt::ConnectionType::UniqueConnection);
+  connect(widget, SIGNAL(viewPathsMatchingReqs(AttributeMatrixSelectionFilterParameter::RequirementType)), this,
+          SLOT(viewPathsMatchingReqs(AttributeMatrixSelectionFilterParameter::RequirementType)), Qt::ConnectionType::UniqueConnection);
+  connect(widget, SIGNAL(viewPathsMatchingReqs(DataArraySelectionFilterParameter::RequirementType)), this, SLOT(viewPathsMatchingReqs(DataArraySelectionFilterParameter::RequirementType)),
           Qt::ConnectionType::UniqueConnection);
-  connect(widget, SIGNAL(endViewPaths()), getDataStructureWidget(), SLOT(clearViewRequirements()), Qt::ConnectionType::UniqueConnection);
+  connect(widget, SIGNAL(endViewPaths()), this, SLOT(clearViewRequirements()), Qt::ConnectionType::UniqueConnection);
   connect(getDataStructureWidget(), SIGNAL(filterPath(DataArrayPath)), widget, SIGNAL(filterPath(DataArrayPath)), Qt::ConnectionType::UniqueConnection);
   connect(getDataStructureWidget(), SIGNAL(endDataStructureFiltering()), widget, SIGNAL(endDataStructureFiltering()), Qt::ConnectionType::UniqueConnection);
   connect(getDataStructureWidget(), SIGNAL(applyPathToFilteringParameter(DataArrayPath)), widget, SIGNAL(applyPathToFilteringParameter(DataArrayPath)));
@@ -1183,19 +1899,150 @@ PipelineModel* SIMPLView_UI::getPipelineModel()
 
 // -----------------------------------------------------------------------------
 bool SIMPLView_UI::hasFilterInPipeline(const QUuid& uuid) const
+{
+  updateFilterUuidIndex();
+  return m_FilterUuids.contains(uuid);
+}
+
+// -----------------------------------------------------------------------------
+const QSet<QUuid>& SIMPLView_UI::filterUuidsInPipeline() const
+{
+  updateFilterUuidIndex();
+  return m_FilterUuids;
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::updateFilterUuidIndex() const
 {
   SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
   PipelineModel* model = pipelineView->getPipelineModel();
-  for(size_t i = 0; i < model->rowCount(); i++)
+
+  // The row count check catches any change that was not reported row by row
+  if(!m_FilterUuidIndexDirty && m_FilterRowUuids.size() == model->rowCount())
   {
-    AbstractFilter::Pointer filter = model->filter(model->index(i, PipelineItem::Contents));
-    if(filter->getUuid() == uuid)
+    return;
+  }
+
+  m_FilterRowUuids.clear();
+  m_FilterUuidCounts.clear();
+  m_FilterUuids.clear();
+  m_FilterUuidIndexDirty = false;
+  filterUuidRowsInserted(0, model->rowCount() - 1);
+}
+
+// -----------------------------------------------------------------------------
+QUuid SIMPLView_UI::filterUuidAtRow(int row) const
+{
+  SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
+  PipelineModel* model = pipelineView->getPipelineModel();
+  AbstractFilter::Pointer filter = model->filter(model->index(row, PipelineItem::Contents));
+  return filter.get() != nullptr ? filter->getUuid() : QUuid();
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::addFilterUuid(const QUuid& uuid) const
+{
+  if(uuid.isNull())
+  {
+    return;
+  }
+  int& count = m_FilterUuidCounts[uuid];
+  if(count++ == 0)
+  {
+    m_FilterUuids.insert(uuid);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::removeFilterUuid(const QUuid& uuid) const
+{
+  auto iter = m_FilterUuidCounts.find(uuid);
+  if(iter == m_FilterUuidCounts.end())
+  {
+    return;
+  }
+  if(--iter.value() == 0)
+  {
+    m_FilterUuidCounts.erase(iter);
+    m_FilterUuids.remove(uuid);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::filterUuidRowsInserted(int first, int last) const
+{
+  if(m_FilterUuidIndexDirty || first > m_FilterRowUuids.size())
+  {
+    m_FilterUuidIndexDirty = true;
+    return;
+  }
+
+  for(int row = first; row <= last; row++)
+  {
+    QUuid uuid = filterUuidAtRow(row);
+    m_FilterRowUuids.insert(row, uuid);
+    addFilterUuid(uuid);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::filterUuidRowsRemoved(int first, int last) const
+{
+  if(m_FilterUuidIndexDirty || last >= m_FilterRowUuids.size())
+  {
+    m_FilterUuidIndexDirty = true;
+    return;
+  }
+
+  for(int row = first; row <= last; row++)
+  {
+    removeFilterUuid(m_FilterRowUuids[row]);
+  }
+  m_FilterRowUuids.remove(first, last - first + 1);
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::filterUuidRowsMoved(int start, int end, int destinationRow) const
+{
+  // Moving rows does not change which filters are in the pipeline, only their order
+  if(m_FilterUuidIndexDirty || end >= m_FilterRowUuids.size())
+  {
+    m_FilterUuidIndexDirty = true;
+    return;
+  }
+
+  int count = end - start + 1;
+  QVector<QUuid> moved = m_FilterRowUuids.mid(start, count);
+  m_FilterRowUuids.remove(start, count);
+  if(destinationRow > end)
+  {
+    destinationRow -= count;
+  }
+  for(int i = 0; i < count; i++)
+  {
+    m_FilterRowUuids.insert(destinationRow + i, moved[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::filterUuidRowsChanged(int first, int last) const
+{
+  if(m_FilterUuidIndexDirty || last >= m_FilterRowUuids.size())
+  {
+    m_FilterUuidIndexDirty = true;
+    return;
+  }
+
+  for(int row = first; row <= last; row++)
+  {
+    QUuid uuid = filterUuidAtRow(row);
+    if(uuid != m_FilterRowUuids[row])
     {
-      return true;
+      removeFilterUuid(m_FilterRowUuids[row]);
+      addFilterUuid(uuid);
+      m_FilterRowUuids[row] = uuid;
     }
   }
-
-  return false;
 }
 
 // -----------------------------------------------------------------------------
@@ -1239,6 +2086,45 @@ void SIMPLView_UI::clearPipeline(bool playAnimation)
   pipelineView->clearPipeline(playAnimation);
 }
 
+// -----------------------------------------------------------------------------
+int SIMPLView_UI::replaceFilterInstances(const QSet<QUuid>& uuids)
+{
+  SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
+  PipelineModel* model = pipelineView->getPipelineModel();
+  FilterManager* filterManager = FilterManager::Instance();
+
+  int replacedCount = 0;
+  int rowCount = model->rowCount();
+  for(int row = 0; row < rowCount; row++)
+  {
+    AbstractFilter::Pointer oldFilter = model->filter(model->index(row, PipelineItem::Contents));
+    if(oldFilter.get() == nullptr || !uuids.contains(oldFilter->getUuid()))
+    {
+      continue;
+    }
+
+    IFilterFactory::Pointer factory = filterManager->getFactoryFromUuid(oldFilter->getUuid());
+    if(factory.get() == nullptr)
+    {
+      addStdOutputMessage(tr("\"%1\" is no longer provided by any Python file. The filter at position %2 keeps its previous code.").arg(oldFilter->getHumanLabel()).arg(row + 1));
+      continue;
+    }
+
+    AbstractFilter::Pointer newFilter = factory->create();
+    QJsonObject parameters;
+    oldFilter->writeFilterParameters(parameters);
+    newFilter->readFilterParameters(parameters);
+    newFilter->setEnabled(oldFilter->getEnabled());
+
+    // The row is removed and filled again, so the rows after it keep their positions
+    pipelineView->removeFilter(oldFilter, false);
+    pipelineView->addFilter(newFilter, row, false);
+    replacedCount++;
+  }
+
+  return replacedCount;
+}
+
 #ifdef SIMPL_EMBED_PYTHON
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::setPythonGUIEnabled(bool value)
@@ -36,7 +36,13 @@
 #pragma once
 
 //-- Qt Includes
+#include <functional>
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QHash>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QUuid>
 #include <QtCore/QString>
 #include <QtCore/QVector>
 #include <QtGui/QResizeEvent>
@@ -52,6 +58,11 @@
 #include "SVWidgetsLib/QtSupport/QtSSettings.h"
 #include "SVWidgetsLib/Widgets/FilterInputWidget.h"
 
+#include "SIMPLView/DataArrayPathIndex.h"
+#include "SIMPLView/DataBrowserHighlighter.h"
+#include "SIMPLView/PipelineFileLoader.h"
+#include "SIMPLView/PipelineMessageQueue.h"
+
 //-- UIC generated Header
 #include "ui_SIMPLView_UI.h"
 
@@ -62,6 +73,8 @@ class FilterListWidget;
 class UpdateCheckDialog;
 class UpdateCheckData;
 class UpdateCheck;
+class QLabel;
+class QTimer;
 class QToolButton;
 class AboutSIMPLView;
 class StatusBarWidget;
@@ -71,6 +84,9 @@ class PipelineListWidget;
 class SVPipelineViewWidget;
 class SIMPLViewMenuItems;
 class SIMPLViewUIMessageHandler;
+class PipelineSearchDialog;
+class FilterQuickFindDialog;
+class FilterHelpDialog;
 
 /**
  * @class SIMPLView_UI SIMPLView_UI Applications/SIMPLView/SIMPLView_UI.h
@@ -89,8 +105,6 @@ public:
   SIMPLView_UI(QWidget* parent = nullptr);
   ~SIMPLView_UI() override;
 
-  friend SIMPLViewUIMessageHandler;
-
   /**
    * @brief eventFilter
    * @param watched
@@ -123,17 +137,32 @@ public:
   void writeSettings();
 
   /**
-   * @brief openPipeline
+   * @brief Starts reading the pipeline in filePath on a worker thread. The filters are added to
+   * the pipeline view by pipelineLoadFinished() once they have all been created.
+   * Errors found while reading the file are reported to the user when the load finishes.
    * @param filePath
-   * @return
+   * @return 0 if the pipeline is being opened, -1 if another pipeline is still being opened in this
+   * window and -2 if the file cannot be read
    */
   int openPipeline(const QString& filePath);
 
   /**
-   * @brief executePipeline
+   * @brief Returns true while openPipeline() is reading a file for this window
+   * @return
+   */
+  bool isPipelineLoading() const;
+
+  /**
+   * @brief Executes the pipeline. If a pipeline is still being opened it is executed as soon as it is complete.
    */
   void executePipeline();
 
+  /**
+   * @brief Returns true while this window's pipeline is executing
+   * @return
+   */
+  bool isPipelineRunning();
+
   /**
    * @brief showDockWidget
    */
@@ -146,6 +175,13 @@ public:
    */
   bool hasFilterInPipeline(const QUuid& uuid) const;
 
+  /**
+   * @brief Returns the UUIDs of every filter in the pipeline model. The set is only valid until
+   * the pipeline model changes.
+   * @return
+   */
+  const QSet<QUuid>& filterUuidsInPipeline() const;
+
   /**
    * @brief Returns true if the undo stack is clean
    * @return
@@ -175,6 +211,16 @@ public:
    */
   void clearPipeline(bool playAnimation);
 
+  /**
+   * @brief Replaces every filter in the pipeline whose UUID is in uuids with a new instance from
+   * the factory that is registered now. Parameter values and the enabled state are copied over.
+   * Each replacement is pushed onto the undo stack, so the earlier history is kept. Filters that
+   * no longer have a factory are left as they are.
+   * @param uuids
+   * @return The number of filters that were replaced
+   */
+  int replaceFilterInstances(const QSet<QUuid>& uuids);
+
 public Q_SLOTS:
   /**
    * @brief setFilterBeingDragged
@@ -314,16 +360,22 @@ protected Q_SLOTS:
    */
   void readVersionCheckSettings();
 
+  /**
+   * @brief Stops everything that reads the data container arrays, because the pipeline may
+   * resize or free them while it runs. Called for every run, whichever control started it.
+   */
+  void pipelineDidStart();
+
   /**
    * @brief pipelineDidFinish
    */
   void pipelineDidFinish();
 
   /**
-   * @brief processPipelineMessage
-   * @param msg
+   * @brief Applies all of the queued pipeline messages to the status bar, progress bar and
+   * pipeline output widget in a single update.
    */
-  void processPipelineMessage(const AbstractMessage::Pointer& msg);
+  void flushPipelineMessages();
 
   /**
    * @brief setFilterInputWidget
@@ -349,6 +401,62 @@ protected Q_SLOTS:
    */
   void filterSelectionChanged(const QItemSelection& selected, const QItemSelection& deselected);
 
+  /**
+   * @brief Shows the statistics of the attribute array at index in the data browser
+   * @param index
+   */
+  void dataBrowserItemSelected(const QModelIndex& index);
+
+  /**
+   * @brief Opens a value inspector for the attribute array at index in the data browser
+   * @param index
+   */
+  void showArrayValues(const QModelIndex& index);
+
+  /**
+   * @brief Highlights the data containers in the data browser that satisfy dcReqs
+   * @param dcReqs
+   */
+  void viewPathsMatchingReqs(DataContainerSelectionFilterParameter::RequirementType dcReqs);
+
+  /**
+   * @brief Highlights the attribute matrices in the data browser that satisfy amReqs
+   * @param amReqs
+   */
+  void viewPathsMatchingReqs(AttributeMatrixSelectionFilterParameter::RequirementType amReqs);
+
+  /**
+   * @brief Highlights the attribute arrays in the data browser that satisfy daReqs
+   * @param daReqs
+   */
+  void viewPathsMatchingReqs(DataArraySelectionFilterParameter::RequirementType daReqs);
+
+  /**
+   * @brief Removes the requirement highlighting from the data browser unless another
+   * requirement is shown before the clear timer fires
+   */
+  void clearViewRequirements();
+
+  /**
+   * @brief Removes the requirement highlighting from the data browser now
+   */
+  void applyClearViewRequirements();
+
+  /**
+   * @brief Adds the filters read by openPipeline() to the pipeline view
+   */
+  void pipelineLoadFinished();
+
+  /**
+   * @brief Starts reading a .dream3d file whose load waited for the running pipelines
+   */
+  void startDeferredPipelineLoad();
+
+  /**
+   * @brief Gives up on the .dream3d file that is waiting for the running pipelines
+   */
+  void cancelDeferredPipelineLoad();
+
   // Our Signals that we can emit custom for this class
 Q_SIGNALS:
   void parentResized();
@@ -373,6 +481,36 @@ private:
 
   FilterInputWidget* m_FilterInputWidget = nullptr;
 
+  PipelineMessageQueue m_PipelineMessageQueue;
+  QTimer* m_MessageFlushTimer = nullptr;
+
+  AbstractFilter::Pointer m_DataBrowserFilter;
+  DataArrayPathIndex m_DataArrayPathIndex;
+  DataBrowserHighlighter m_DataBrowserHighlighter;
+  std::function<QVector<DataArrayPath>()> m_ViewedPathsQuery;
+  QVector<DataArrayPath> m_ViewedPaths;
+  bool m_ViewedPathsValid = false;
+  QTimer* m_ClearViewTimer = nullptr;
+
+  QFutureWatcher<PipelineFileLoader::Result>* m_PipelineLoadWatcher = nullptr;
+
+  // The UUID of the filter in each row, how many rows hold each UUID, and the UUIDs that are present
+  mutable QVector<QUuid> m_FilterRowUuids;
+  mutable QHash<QUuid, int> m_FilterUuidCounts;
+  mutable QSet<QUuid> m_FilterUuids;
+  mutable bool m_FilterUuidIndexDirty = true;
+  bool m_ExecuteAfterLoad = false;
+  QString m_DeferredLoadFilePath;
+  QWidget* m_DeferredLoadWidget = nullptr;
+  QLabel* m_DeferredLoadLabel = nullptr;
+  bool m_PipelineEditsBlocked = false;
+  bool m_PipelineRunRecorded = false;
+  QHash<QAction*, bool> m_ActionStatesBeforeLoad;
+
+  PipelineSearchDialog* m_PipelineSearchDialog = nullptr;
+  FilterQuickFindDialog* m_FilterQuickFindDialog = nullptr;
+  FilterHelpDialog* m_FilterHelpDialog = nullptr;
+
   QMenu* m_MenuFile = nullptr;
   QMenu* m_MenuEdit = nullptr;
   QMenu* m_MenuView = nullptr;
@@ -396,6 +534,12 @@ private:
   QAction* m_ActionCheckForUpdates = nullptr;
   QAction* m_ActionPluginInformation = nullptr;
   QAction* m_ActionClearCache = nullptr;
+  QAction* m_ActionThreadBudget = nullptr;
+  QAction* m_ActionSingleInstance = nullptr;
+  QAction* m_ActionRetainFreedMemory = nullptr;
+  QAction* m_ActionInspectArrayValues = nullptr;
+  QAction* m_ActionFindPipelines = nullptr;
+  QAction* m_ActionQuickAddFilter = nullptr;
   QAction* m_ActionSetDataFolder = nullptr;
   QAction* m_ActionShowDataFolder = nullptr;
 
@@ -434,6 +578,125 @@ private:
    */
   PipelineModel* getPipelineModel();
 
+  /**
+   * @brief Shows the data structure of filter in the data browser. Nothing is rebuilt if the
+   * data browser already shows this filter and its data structure has not changed.
+   * @param filter
+   */
+  void activateDataBrowserFilter(const AbstractFilter::Pointer& filter);
+
+  /**
+   * @brief Rebuilds the data browser only if the data structure of the shown filter has changed
+   */
+  void refreshDataBrowser();
+
+  /**
+   * @brief Highlights the data browser items of the paths that match the current requirement.
+   * The items are only touched if the paths differ from the ones already highlighted.
+   * @param query Returns the matching paths from the DataArrayPathIndex. It is kept so the
+   * highlight can be rebuilt when the data browser is rebuilt.
+   */
+  void showViewedPaths(const std::function<QVector<DataArrayPath>()>& query);
+
+  /**
+   * @brief Forgets the data browser items after the tree was rebuilt and highlights the current requirement again
+   */
+  void dataBrowserRebuilt();
+
+  /**
+   * @brief Reads the pipeline in filePath on a worker thread
+   * @param filePath
+   */
+  void startPipelineLoad(const QString& filePath);
+
+  /**
+   * @brief Blocks every way of changing or saving the pipeline while a file is being opened.
+   * The enabled state of the blocked actions is restored afterwards.
+   * @param blocked
+   */
+  void setPipelineEditsBlocked(bool blocked);
+
+  /**
+   * @brief Shows the warnings and errors that the pipeline readers reported on the worker thread
+   * in the issues and output widgets
+   * @param messages
+   */
+  void showPipelineLoadMessages(const QVector<AbstractMessage::Pointer>& messages);
+
+  /**
+   * @brief Rebuilds the filter UUID index if the pipeline model was reset or changed in a way
+   * that was not reported row by row
+   */
+  void updateFilterUuidIndex() const;
+
+  /**
+   * @brief Returns the UUID of the filter in the given row of the pipeline model
+   * @param row
+   * @return
+   */
+  QUuid filterUuidAtRow(int row) const;
+
+  /**
+   * @brief Counts one more row that holds uuid
+   * @param uuid
+   */
+  void addFilterUuid(const QUuid& uuid) const;
+
+  /**
+   * @brief Counts one row less that holds uuid
+   * @param uuid
+   */
+  void removeFilterUuid(const QUuid& uuid) const;
+
+  /**
+   * @brief Adds the filters of the inserted rows to the UUID index
+   * @param first
+   * @param last
+   */
+  void filterUuidRowsInserted(int first, int last) const;
+
+  /**
+   * @brief Removes the filters of the removed rows from the UUID index
+   * @param first
+   * @param last
+   */
+  void filterUuidRowsRemoved(int first, int last) const;
+
+  /**
+   * @brief Keeps the row order of the UUID index in step with moved rows
+   * @param start
+   * @param end
+   * @param destinationRow
+   */
+  void filterUuidRowsMoved(int start, int end, int destinationRow) const;
+
+  /**
+   * @brief Updates the UUID index for rows whose filter may have been replaced
+   * @param first
+   * @param last
+   */
+  void filterUuidRowsChanged(int first, int last) const;
+
+  /**
+   * @brief Shows a local help page in the embedded help viewer and prefetches the help of
+   * the other filters in the pipeline
+   * @param url
+   * @param className The filter the page belongs to, if known. Used to build a page when the
+   * help file is missing.
+   * @return false if the URL is not a local file and has to be opened in a web browser
+   */
+  bool showEmbeddedHelp(const QUrl& url, const QString& className = QString());
+
+  /**
+   * @brief Queues a message from the running pipeline. This is connected directly to the pipeline
+   * so it may run on the worker thread. It is static so that it can only reach the queue and the
+   * flush timer it is given; the widgets are updated later by flushPipelineMessages() on the GUI thread.
+   * @param messageQueue
+   * @param flushTimer Started through a queued call so the timer is only touched on its own thread
+   * @param msg
+   */
+  static void QueuePipelineMessage(PipelineMessageQueue* messageQueue, QTimer* flushTimer, const AbstractMessage::Pointer& msg);
+
 public:
   SIMPLView_UI(const SIMPLView_UI&) = delete;            // Copy Constructor Not Implemented
   SIMPLView_UI(SIMPLView_UI&&) = delete;                 // Move Constructor Not Implemented
@@ -36,6 +36,7 @@
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 
 #include <QtGui/QFontDatabase>
 
@@ -174,6 +175,12 @@ int main(int argc, char* argv[])
 
   SIMPLViewApplication qtapp(argc, argv);
 
+  // In single instance mode a SIMPLView that is already running opens the files instead
+  if(qtapp.forwardToRunningInstance())
+  {
+    return 0;
+  }
+
 #ifdef SIMPL_EMBED_PYTHON
   bool hasPythonHome = PythonLoader::checkPythonHome();
   bool enablePython = hasPythonHome;
@@ -218,10 +225,20 @@ int main(int argc, char* argv[])
 
 #ifdef SIMPL_EMBED_PYTHON
   qtapp.setPythonGUIEnabled(enablePython);
-  if(enablePython)
-  {
+
+  // Importing the Python filters can take a while, so unless a pipeline was given on the
+  // command line they are loaded after the first window is on screen. Files that the operating
+  // system or another SIMPLView asks to open in the meantime wait until the filters exist; the
+  // reload releases them once it has actually run, which may be after this lambda returns.
+  bool deferPythonLoading = qtapp.getCommandLineFilePaths().size() != 1;
+  auto loadPythonFilters = [&qtapp]() {
     qtapp.reloadPythonFilters();
     PythonLoader::addToPythonPath(PythonLoader::defaultSIMPLPythonLibPath());
+  };
+  qtapp.setFileOpensHeld(enablePython && deferPythonLoading);
+  if(enablePython && !deferPythonLoading)
+  {
+    loadPythonFilters();
   }
 #endif
 
@@ -249,10 +266,10 @@ int main(int argc, char* argv[])
 #endif
 
   // Open pipeline if SIMPLView was opened from a compatible file
-  if(argc == 2)
+  QStringList filePaths = qtapp.getCommandLineFilePaths();
+  if(filePaths.size() == 1)
   {
-    char* two = argv[1];
-    QString filePath = QString::fromLatin1(two);
+    QString filePath = filePaths.front();
     if(!filePath.isEmpty())
     {
       qtapp.newInstanceFromFile(filePath);
@@ -264,6 +281,13 @@ int main(int argc, char* argv[])
     ui->show();
   }
 
+#ifdef SIMPL_EMBED_PYTHON
+  if(enablePython && deferPythonLoading)
+  {
+    QTimer::singleShot(0, &qtapp, loadPythonFilters);
+  }
+#endif
+
 #ifdef SIMPL_USE_MKDOCS
   QtSDocServer::Instance();
 #endif
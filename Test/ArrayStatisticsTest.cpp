@@ -0,0 +1,253 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+#include "UnitTestSupport.hpp"
+
+#include "SIMPLView/ArrayStatistics.h"
+
+class ArrayStatisticsTest
+{
+public:
+  ArrayStatisticsTest() = default;
+  ~ArrayStatisticsTest() = default;
+  ArrayStatisticsTest(const ArrayStatisticsTest&) = delete;            // Copy Constructor
+  ArrayStatisticsTest(ArrayStatisticsTest&&) = delete;                 // Move Constructor
+  ArrayStatisticsTest& operator=(const ArrayStatisticsTest&) = delete; // Copy Assignment
+  ArrayStatisticsTest& operator=(ArrayStatisticsTest&&) = delete;      // Move Assignment
+
+  /**
+   * @brief Computes the statistics one value at a time. The histogram uses the same bin
+   * formula as ArrayStatistics so values on a bin edge land in the same bin.
+   */
+  template <typename T>
+  ArrayStatistics computeReference(const T* data, size_t count, int binCount)
+  {
+    ArrayStatistics stats;
+    double sum = 0.0;
+    stats.min = std::numeric_limits<double>::infinity();
+    stats.max = -std::numeric_limits<double>::infinity();
+    for(size_t i = 0; i < count; i++)
+    {
+      double value = static_cast<double>(data[i]);
+      if(std::isnan(value))
+      {
+        stats.nanCount++;
+        continue;
+      }
+      stats.valueCount++;
+      stats.min = std::min(stats.min, value);
+      stats.max = std::max(stats.max, value);
+      sum += value;
+    }
+    if(stats.valueCount == 0)
+    {
+      stats.min = 0.0;
+      stats.max = 0.0;
+      return stats;
+    }
+    stats.mean = sum / static_cast<double>(stats.valueCount);
+
+    double squares = 0.0;
+    for(size_t i = 0; i < count; i++)
+    {
+      double value = static_cast<double>(data[i]);
+      if(!std::isnan(value))
+      {
+        squares += (value - stats.mean) * (value - stats.mean);
+      }
+    }
+    stats.stdDev = std::sqrt(squares / static_cast<double>(stats.valueCount));
+
+    double range = stats.max - stats.min;
+    stats.histogram.fill(0, binCount);
+    double scale = range > 0.0 ? binCount / range : 0.0;
+    for(size_t i = 0; i < count; i++)
+    {
+      double value = static_cast<double>(data[i]);
+      if(!std::isnan(value))
+      {
+        size_t bin = static_cast<size_t>((value - stats.min) * scale);
+        stats.histogram[static_cast<int>(std::min(bin, static_cast<size_t>(binCount - 1)))]++;
+      }
+    }
+    return stats;
+  }
+
+  /**
+   * @brief Returns true if the two values agree to within a relative tolerance. The lanes
+   * add the values in a different order than the reference does.
+   */
+  bool isClose(double value, double reference)
+  {
+    return std::abs(value - reference) <= 1.0e-9 * std::max(1.0, std::abs(reference));
+  }
+
+  /**
+   * @brief Compares ArrayStatistics::Compute() on array with the scalar reference
+   */
+  template <typename T>
+  void compareWithReference(const typename DataArray<T>::Pointer& array, int binCount)
+  {
+    ArrayStatistics stats = ArrayStatistics::Compute(array, binCount);
+    ArrayStatistics reference = computeReference(array->getPointer(0), array->getSize(), binCount);
+
+    DREAM3D_REQUIRE(stats.valid)
+    DREAM3D_REQUIRE_EQUAL(stats.numberOfTuples, array->getNumberOfTuples())
+    DREAM3D_REQUIRE_EQUAL(stats.valueCount, reference.valueCount)
+    DREAM3D_REQUIRE_EQUAL(stats.nanCount, reference.nanCount)
+    DREAM3D_REQUIRE(stats.min == reference.min)
+    DREAM3D_REQUIRE(stats.max == reference.max)
+    DREAM3D_REQUIRE(isClose(stats.mean, reference.mean))
+    DREAM3D_REQUIRE(isClose(stats.stdDev, reference.stdDev))
+    DREAM3D_REQUIRE(stats.histogram == reference.histogram)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFloatArray()
+  {
+    // 1003 is not a multiple of the lane count, so the tail loop is covered too
+    const size_t count = 1003;
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(count, "Values", true);
+    float* data = array->getPointer(0);
+    for(size_t i = 0; i < count; i++)
+    {
+      data[i] = static_cast<float>((i * 7919) % 1000) * 0.25f - 100.0f;
+    }
+    data[0] = std::numeric_limits<float>::quiet_NaN();
+    data[9] = std::numeric_limits<float>::quiet_NaN();
+    data[count - 1] = std::numeric_limits<float>::quiet_NaN();
+
+    compareWithReference<float>(array, ArrayStatistics::k_DefaultBinCount);
+    compareWithReference<float>(array, 7);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestIntegerArrays()
+  {
+    Int32ArrayType::Pointer int32Array = Int32ArrayType::CreateArray(17, "Int32", true);
+    int32_t* int32Data = int32Array->getPointer(0);
+    for(int32_t i = 0; i < 17; i++)
+    {
+      int32Data[i] = (i % 2 == 0) ? -i * 1000 : i * 3;
+    }
+    compareWithReference<int32_t>(int32Array, ArrayStatistics::k_DefaultBinCount);
+
+    UInt8ArrayType::Pointer uint8Array = UInt8ArrayType::CreateArray(5, "UInt8", true);
+    uint8_t* uint8Data = uint8Array->getPointer(0);
+    for(uint8_t i = 0; i < 5; i++)
+    {
+      uint8Data[i] = static_cast<uint8_t>(250 + i);
+    }
+    compareWithReference<uint8_t>(uint8Array, 3);
+
+    // A constant array has no range, so every value lands in the first bin
+    DoubleArrayType::Pointer constantArray = DoubleArrayType::CreateArray(20, "Constant", true);
+    constantArray->initializeWithValue(4.5);
+    compareWithReference<double>(constantArray, 4);
+    ArrayStatistics stats = ArrayStatistics::Compute(constantArray, 4);
+    DREAM3D_REQUIRE(stats.histogram[0] == 20)
+    DREAM3D_REQUIRE(stats.stdDev == 0.0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSpecialArrays()
+  {
+    FloatArrayType::Pointer nanArray = FloatArrayType::CreateArray(12, "NaN", true);
+    nanArray->initializeWithValue(std::numeric_limits<float>::quiet_NaN());
+    ArrayStatistics stats = ArrayStatistics::Compute(nanArray);
+    DREAM3D_REQUIRE(stats.valid)
+    DREAM3D_REQUIRE(stats.valueCount == 0)
+    DREAM3D_REQUIRE(stats.nanCount == 12)
+    DREAM3D_REQUIRE(stats.min == 0.0)
+    DREAM3D_REQUIRE(stats.max == 0.0)
+    DREAM3D_REQUIRE(stats.histogram.isEmpty())
+
+    // An infinite range cannot be binned
+    DoubleArrayType::Pointer infiniteArray = DoubleArrayType::CreateArray(3, "Infinite", true);
+    infiniteArray->setValue(0, 1.0);
+    infiniteArray->setValue(1, std::numeric_limits<double>::infinity());
+    infiniteArray->setValue(2, 2.0);
+    stats = ArrayStatistics::Compute(infiniteArray);
+    DREAM3D_REQUIRE(stats.valid)
+    DREAM3D_REQUIRE(stats.histogram.isEmpty())
+
+    FloatArrayType::Pointer unallocatedArray = FloatArrayType::CreateArray(10, "Unallocated", false);
+    stats = ArrayStatistics::Compute(unallocatedArray);
+    DREAM3D_REQUIRE(!stats.valid)
+    DREAM3D_REQUIRE(!stats.errorMessage.isEmpty())
+
+    stats = ArrayStatistics::Compute(IDataArray::NullPointer());
+    DREAM3D_REQUIRE(!stats.valid)
+
+    std::atomic<bool> cancel(true);
+    FloatArrayType::Pointer canceledArray = FloatArrayType::CreateArray(10, "Canceled", true);
+    canceledArray->initializeWithZeros();
+    stats = ArrayStatistics::Compute(canceledArray, ArrayStatistics::k_DefaultBinCount, &cancel);
+    DREAM3D_REQUIRE(!stats.valid)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestFloatArray())
+    DREAM3D_REGISTER_TEST(TestIntegerArrays())
+    DREAM3D_REGISTER_TEST(TestSpecialArrays())
+  }
+};
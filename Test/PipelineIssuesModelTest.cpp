@@ -0,0 +1,138 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include "UnitTestSupport.hpp"
+
+#include "SIMPLView/PipelineIssuesModel.h"
+
+class PipelineIssuesModelTest
+{
+public:
+  PipelineIssuesModelTest() = default;
+  ~PipelineIssuesModelTest() = default;
+  PipelineIssuesModelTest(const PipelineIssuesModelTest&) = delete;            // Copy Constructor
+  PipelineIssuesModelTest(PipelineIssuesModelTest&&) = delete;                 // Move Constructor
+  PipelineIssuesModelTest& operator=(const PipelineIssuesModelTest&) = delete; // Copy Assignment
+  PipelineIssuesModelTest& operator=(PipelineIssuesModelTest&&) = delete;      // Move Assignment
+
+  /**
+   * @brief Returns the display value of the given cell
+   */
+  QVariant cell(const PipelineIssuesModel& model, int row, int column)
+  {
+    return model.data(model.index(row, column));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestDescriptionTemplate()
+  {
+    DREAM3D_REQUIRE(PipelineIssuesModel::CreateDescriptionTemplate("Array 12 of 345 tuples") == "Array # of # tuples")
+    DREAM3D_REQUIRE(PipelineIssuesModel::CreateDescriptionTemplate("Value 1.5 at -42") == "Value #.# at -#")
+    DREAM3D_REQUIRE(PipelineIssuesModel::CreateDescriptionTemplate("No numbers here") == "No numbers here")
+    DREAM3D_REQUIRE(PipelineIssuesModel::CreateDescriptionTemplate("007") == "#")
+    DREAM3D_REQUIRE(PipelineIssuesModel::CreateDescriptionTemplate(QString()).isEmpty())
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestMergeIssues()
+  {
+    using IssueType = PipelineIssuesModel::IssueType;
+
+    PipelineIssuesModel model;
+    model.addIssue(IssueType::Error, 2, "Threshold", "MultiThresholdObjects", "Value 10 is out of range", -100);
+    model.addIssue(IssueType::Error, 2, "Threshold", "MultiThresholdObjects", "Value 20 is out of range", -100);
+    // A different code, filter index or type is a different issue
+    model.addIssue(IssueType::Error, 2, "Threshold", "MultiThresholdObjects", "Value 30 is out of range", -101);
+    model.addIssue(IssueType::Error, 3, "Threshold", "MultiThresholdObjects", "Value 40 is out of range", -100);
+    model.addIssue(IssueType::Warning, 2, "Threshold", "MultiThresholdObjects", "Value 50 is out of range", -100);
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 0)
+
+    model.commitPendingIssues();
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 4)
+    DREAM3D_REQUIRE_EQUAL(model.getErrorCount(), 4)
+    DREAM3D_REQUIRE_EQUAL(model.getWarningCount(), 1)
+
+    // The merged row shows the first description and counts every message
+    DREAM3D_REQUIRE(cell(model, 0, PipelineIssuesModel::DescriptionColumn).toString() == "Value 10 is out of range")
+    DREAM3D_REQUIRE_EQUAL(cell(model, 0, PipelineIssuesModel::CountColumn).toInt(), 2)
+    DREAM3D_REQUIRE_EQUAL(cell(model, 0, PipelineIssuesModel::IndexColumn).toInt(), 2)
+    DREAM3D_REQUIRE_EQUAL(cell(model, 0, PipelineIssuesModel::CodeColumn).toInt(), -100)
+    DREAM3D_REQUIRE(cell(model, 0, PipelineIssuesModel::FilterColumn).toString() == "Threshold")
+    DREAM3D_REQUIRE(model.data(model.index(0, PipelineIssuesModel::FilterColumn), PipelineIssuesModel::FilterClassNameRole).toString() == "MultiThresholdObjects")
+    for(int row = 1; row < model.rowCount(); row++)
+    {
+      DREAM3D_REQUIRE_EQUAL(cell(model, row, PipelineIssuesModel::CountColumn).toInt(), 1)
+    }
+
+    // Later messages merge into rows that were committed earlier
+    model.addIssue(IssueType::Error, 2, "Threshold", "MultiThresholdObjects", "Value 60 is out of range", -100);
+    model.commitPendingIssues();
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 4)
+    DREAM3D_REQUIRE_EQUAL(cell(model, 0, PipelineIssuesModel::CountColumn).toInt(), 3)
+    DREAM3D_REQUIRE(model.data(model.index(0, PipelineIssuesModel::DescriptionColumn), Qt::ToolTipRole).toString().contains("Value 60 is out of range"))
+
+    // Pipeline level issues have no filter index
+    model.addIssue(IssueType::Warning, -1, "Pipeline", QString(), "The pipeline is empty", -1);
+    model.commitPendingIssues();
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 5)
+    DREAM3D_REQUIRE(!cell(model, 4, PipelineIssuesModel::IndexColumn).isValid())
+
+    model.clear();
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(model.getErrorCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(model.getWarningCount(), 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestDescriptionTemplate())
+    DREAM3D_REGISTER_TEST(TestMergeIssues())
+  }
+};
@@ -0,0 +1,195 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include <QtCore/QSet>
+
+#include "UnitTestSupport.hpp"
+
+#include "SIMPLView/PipelineMessageQueue.h"
+
+class PipelineMessageQueueTest
+{
+public:
+  PipelineMessageQueueTest() = default;
+  ~PipelineMessageQueueTest() = default;
+  PipelineMessageQueueTest(const PipelineMessageQueueTest&) = delete;            // Copy Constructor
+  PipelineMessageQueueTest(PipelineMessageQueueTest&&) = delete;                 // Move Constructor
+  PipelineMessageQueueTest& operator=(const PipelineMessageQueueTest&) = delete; // Copy Assignment
+  PipelineMessageQueueTest& operator=(PipelineMessageQueueTest&&) = delete;      // Move Assignment
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRepeatedLines()
+  {
+    PipelineMessageQueue queue;
+    queue.pushStatusMessage("Status A", "Line A");
+    queue.pushStatusMessage("Status A", "Line A");
+    queue.pushStatusMessage("Status A", "Line A");
+    queue.pushStatusMessage("Status B", "Line B");
+    queue.pushStatusMessage("Status C", "Line C");
+    queue.pushStatusMessage("Status C", "Line C");
+
+    PipelineMessageQueue::Batch batch = queue.takeBatch();
+    DREAM3D_REQUIRE(batch.statusMessage == "Status C")
+    DREAM3D_REQUIRE_EQUAL(batch.outputLines.size(), 5)
+    DREAM3D_REQUIRE(batch.outputLines[0] == "Line A")
+    DREAM3D_REQUIRE(batch.outputLines[1].contains("repeated 2 more times"))
+    DREAM3D_REQUIRE(batch.outputLines[2] == "Line B")
+    DREAM3D_REQUIRE(batch.outputLines[3] == "Line C")
+    DREAM3D_REQUIRE(batch.outputLines[4].contains("repeated 1 more times"))
+    DREAM3D_REQUIRE_EQUAL(batch.progress, -1)
+
+    DREAM3D_REQUIRE_EQUAL(queue.getReceivedMessageCount(), 6)
+    DREAM3D_REQUIRE_EQUAL(queue.getMergedMessageCount(), 3)
+
+    // A new run starts without counters or a previous line to merge into
+    queue.resetCounters();
+    queue.pushStatusMessage("Status C", "Line C");
+    batch = queue.takeBatch();
+    DREAM3D_REQUIRE(batch.outputLines == QStringList({"Line C"}))
+    DREAM3D_REQUIRE_EQUAL(queue.getReceivedMessageCount(), 1)
+    DREAM3D_REQUIRE_EQUAL(queue.getMergedMessageCount(), 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestProgress()
+  {
+    PipelineMessageQueue queue;
+    queue.pushProgress(10);
+    queue.pushProgress(20);
+    queue.pushProgress(30);
+
+    PipelineMessageQueue::Batch batch = queue.takeBatch();
+    DREAM3D_REQUIRE_EQUAL(batch.progress, 30)
+    DREAM3D_REQUIRE(batch.outputLines.isEmpty())
+    DREAM3D_REQUIRE_EQUAL(queue.getMergedMessageCount(), 2)
+
+    batch = queue.takeBatch();
+    DREAM3D_REQUIRE_EQUAL(batch.progress, -1)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRequestFlush()
+  {
+    PipelineMessageQueue queue;
+    DREAM3D_REQUIRE(queue.requestFlush())
+    DREAM3D_REQUIRE(!queue.requestFlush())
+    DREAM3D_REQUIRE(!queue.requestFlush())
+
+    queue.takeBatch();
+    DREAM3D_REQUIRE(queue.requestFlush())
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestConcurrentProducers()
+  {
+    const int threadCount = 4;
+    const int linesPerThread = 10000;
+
+    PipelineMessageQueue queue;
+    std::vector<std::thread> threads;
+    for(int t = 0; t < threadCount; t++)
+    {
+      threads.emplace_back([&queue, t, linesPerThread] {
+        for(int i = 0; i < linesPerThread; i++)
+        {
+          QString line = QString("Thread %1 Line %2").arg(t).arg(i);
+          queue.pushStatusMessage(line, line);
+        }
+      });
+    }
+
+    // Drain the queue while the producers run, as the GUI thread does
+    QSet<QString> lines;
+    int takenLines = 0;
+    auto drain = [&] {
+      PipelineMessageQueue::Batch batch = queue.takeBatch();
+      takenLines += batch.outputLines.size();
+      for(const QString& line : batch.outputLines)
+      {
+        lines.insert(line);
+      }
+    };
+    for(int i = 0; i < 100; i++)
+    {
+      drain();
+      std::this_thread::yield();
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    drain();
+
+    // Every line is distinct, so nothing may be merged or lost
+    DREAM3D_REQUIRE_EQUAL(takenLines, threadCount * linesPerThread)
+    DREAM3D_REQUIRE_EQUAL(lines.size(), threadCount * linesPerThread)
+    DREAM3D_REQUIRE_EQUAL(queue.getReceivedMessageCount(), static_cast<size_t>(threadCount * linesPerThread))
+    DREAM3D_REQUIRE_EQUAL(queue.getMergedMessageCount(), 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRepeatedLines())
+    DREAM3D_REGISTER_TEST(TestProgress())
+    DREAM3D_REGISTER_TEST(TestRequestFlush())
+    DREAM3D_REGISTER_TEST(TestConcurrentProducers())
+  }
+};
@@ -0,0 +1,196 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+
+#include <QtCore/QFile>
+#include <QtCore/QStringList>
+#include <QtCore/QTemporaryDir>
+
+#include "UnitTestSupport.hpp"
+
+#include "SIMPLView/PipelineOutputModel.h"
+
+class PipelineOutputModelTest
+{
+public:
+  PipelineOutputModelTest() = default;
+  ~PipelineOutputModelTest() = default;
+  PipelineOutputModelTest(const PipelineOutputModelTest&) = delete;            // Copy Constructor
+  PipelineOutputModelTest(PipelineOutputModelTest&&) = delete;                 // Move Constructor
+  PipelineOutputModelTest& operator=(const PipelineOutputModelTest&) = delete; // Copy Assignment
+  PipelineOutputModelTest& operator=(PipelineOutputModelTest&&) = delete;      // Move Assignment
+
+  /**
+   * @brief Returns the lines "line first" to "line last"
+   */
+  QStringList createLines(int first, int last)
+  {
+    QStringList lines;
+    for(int i = first; i <= last; i++)
+    {
+      lines.push_back(QString("line %1").arg(i));
+    }
+    return lines;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRingBuffer()
+  {
+    PipelineOutputModel model;
+    model.setCapacity(4);
+    DREAM3D_REQUIRE_EQUAL(model.getCapacity(), 4)
+
+    model.appendLines(createLines(0, 2));
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 3)
+    DREAM3D_REQUIRE_EQUAL(model.getSpilledLineCount(), 0)
+
+    // The oldest lines move to the log once the buffer is full
+    model.appendLines(createLines(3, 5));
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 4)
+    DREAM3D_REQUIRE_EQUAL(model.getSpilledLineCount(), 2)
+    DREAM3D_REQUIRE(model.getLine(0) == "line 2")
+    DREAM3D_REQUIRE(model.getLine(3) == "line 5")
+    DREAM3D_REQUIRE(model.data(model.index(1)).toString() == "line 3")
+    DREAM3D_REQUIRE(model.getLine(4).isEmpty())
+
+    // A batch larger than the buffer only keeps its newest lines in memory
+    model.appendLines(createLines(6, 15));
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 4)
+    DREAM3D_REQUIRE_EQUAL(model.getSpilledLineCount(), 12)
+    DREAM3D_REQUIRE(model.getLine(0) == "line 12")
+    DREAM3D_REQUIRE(model.getLine(3) == "line 15")
+
+    model.clear();
+    DREAM3D_REQUIRE_EQUAL(model.rowCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(model.getSpilledLineCount(), 0)
+    DREAM3D_REQUIRE_EQUAL(model.createSearchSnapshot().logSize, 0)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestSaveLog()
+  {
+    QTemporaryDir tempDir;
+    DREAM3D_REQUIRE(tempDir.isValid())
+
+    PipelineOutputModel model;
+    model.setCapacity(4);
+    model.appendLines(createLines(0, 5));
+    model.appendLines(createLines(6, 15));
+
+    // The saved log holds the spilled lines followed by the lines in memory
+    QString filePath = tempDir.filePath("PipelineOutput.log");
+    DREAM3D_REQUIRE(model.saveLog(filePath))
+
+    QFile logFile(filePath);
+    DREAM3D_REQUIRE(logFile.open(QIODevice::ReadOnly))
+    QStringList savedLines = QString::fromUtf8(logFile.readAll()).split('\n', QString::SkipEmptyParts);
+    DREAM3D_REQUIRE(savedLines == createLines(0, 15))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestFind()
+  {
+    PipelineOutputModel model;
+    model.setCapacity(2);
+    model.appendLines({"alpha 0", "beta 1", "alpha 2", "beta 3", "gamma 4", "gamma 5"});
+    PipelineOutputModel::SearchSnapshot snapshot = model.createSearchSnapshot();
+    DREAM3D_REQUIRE_EQUAL(snapshot.lines.size(), 2)
+    DREAM3D_REQUIRE_EQUAL(snapshot.spilledLineCount, 4)
+
+    // Rows are searched case insensitively from the start row
+    PipelineOutputModel::SearchResult result = PipelineOutputModel::Find(snapshot, "GAMMA", 1, true);
+    DREAM3D_REQUIRE_EQUAL(result.row, 1)
+    DREAM3D_REQUIRE_EQUAL(result.spilledLine, -1)
+
+    // The spilled lines come next; forward takes the first match and backward the last one
+    result = PipelineOutputModel::Find(snapshot, "alpha", 1, true);
+    DREAM3D_REQUIRE_EQUAL(result.row, -1)
+    DREAM3D_REQUIRE_EQUAL(result.spilledLine, 0)
+    DREAM3D_REQUIRE(result.spilledText == "alpha 0")
+
+    result = PipelineOutputModel::Find(snapshot, "alpha", 1, false);
+    DREAM3D_REQUIRE_EQUAL(result.spilledLine, 2)
+    DREAM3D_REQUIRE(result.spilledText == "alpha 2")
+
+    // Then the rows on the other side of the start row
+    result = PipelineOutputModel::Find(snapshot, "gamma 4", 1, true);
+    DREAM3D_REQUIRE_EQUAL(result.row, 0)
+
+    result = PipelineOutputModel::Find(snapshot, "delta", 0, true);
+    DREAM3D_REQUIRE_EQUAL(result.row, -1)
+    DREAM3D_REQUIRE_EQUAL(result.spilledLine, -1)
+
+    result = PipelineOutputModel::Find(snapshot, QString(), 0, true);
+    DREAM3D_REQUIRE_EQUAL(result.row, -1)
+
+    // A canceled search does not read the spilled lines
+    std::atomic<bool> cancel(true);
+    result = PipelineOutputModel::Find(snapshot, "beta", 0, true, &cancel);
+    DREAM3D_REQUIRE_EQUAL(result.row, -1)
+    DREAM3D_REQUIRE_EQUAL(result.spilledLine, -1)
+
+    // Lines added after the snapshot was taken are not searched
+    model.appendLines({"beta 6"});
+    result = PipelineOutputModel::Find(snapshot, "beta", 0, true);
+    DREAM3D_REQUIRE_EQUAL(result.spilledLine, 1)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestRingBuffer())
+    DREAM3D_REGISTER_TEST(TestSaveLog())
+    DREAM3D_REGISTER_TEST(TestFind())
+  }
+};
@@ -0,0 +1,154 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QStringList>
+#include <QtCore/QTemporaryDir>
+
+#include "UnitTestSupport.hpp"
+
+#include "SIMPLView/PythonFilterWatcher.h"
+
+class PythonFilterWatcherTest
+{
+public:
+  PythonFilterWatcherTest() = default;
+  ~PythonFilterWatcherTest() = default;
+  PythonFilterWatcherTest(const PythonFilterWatcherTest&) = delete;            // Copy Constructor
+  PythonFilterWatcherTest(PythonFilterWatcherTest&&) = delete;                 // Move Constructor
+  PythonFilterWatcherTest& operator=(const PythonFilterWatcherTest&) = delete; // Copy Assignment
+  PythonFilterWatcherTest& operator=(PythonFilterWatcherTest&&) = delete;      // Move Assignment
+
+  /**
+   * @brief Replaces the contents of filePath
+   */
+  bool writeFile(const QString& filePath, const QByteArray& contents)
+  {
+    QFile file(filePath);
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      return false;
+    }
+    return file.write(contents) == contents.size();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestDiffFileHashes()
+  {
+    PythonFilterWatcher::FileHashes previousHashes = {{"/filters/c.py", "3"}, {"/filters/a.py", "1"}, {"/filters/b.py", "2"}};
+    PythonFilterWatcher::FileHashes currentHashes = {{"/filters/e.py", "5"}, {"/filters/a.py", "1"}, {"/filters/b.py", "9"}, {"/filters/d.py", "4"}};
+
+    QStringList changedFiles;
+    QStringList removedFiles;
+    PythonFilterWatcher::DiffFileHashes(previousHashes, currentHashes, &changedFiles, &removedFiles);
+    DREAM3D_REQUIRE(changedFiles == QStringList({"/filters/b.py", "/filters/d.py", "/filters/e.py"}))
+    DREAM3D_REQUIRE(removedFiles == QStringList({"/filters/c.py"}))
+
+    // The lists are replaced, not appended to
+    PythonFilterWatcher::DiffFileHashes(currentHashes, currentHashes, &changedFiles, &removedFiles);
+    DREAM3D_REQUIRE(changedFiles.isEmpty())
+    DREAM3D_REQUIRE(removedFiles.isEmpty())
+
+    PythonFilterWatcher::DiffFileHashes(PythonFilterWatcher::FileHashes(), previousHashes, &changedFiles, &removedFiles);
+    DREAM3D_REQUIRE_EQUAL(changedFiles.size(), 3)
+    DREAM3D_REQUIRE(removedFiles.isEmpty())
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestScanSearchPaths()
+  {
+    QTemporaryDir tempDir;
+    DREAM3D_REQUIRE(tempDir.isValid())
+    QDir dir(tempDir.path());
+
+    // Enough files that the hashing is split into several tasks
+    const int fileCount = 50;
+    for(int i = 0; i < fileCount; i++)
+    {
+      DREAM3D_REQUIRE(writeFile(dir.filePath(QString("Filter%1.py").arg(i)), QString("# Filter %1\n").arg(i).toUtf8()))
+    }
+    DREAM3D_REQUIRE(writeFile(dir.filePath("ReadMe.txt"), "Not a filter"))
+
+    PythonFilterWatcher::FileHashes baseline = PythonFilterWatcher::ScanSearchPaths({tempDir.path()});
+    DREAM3D_REQUIRE_EQUAL(baseline.size(), fileCount)
+    for(auto iter = baseline.constBegin(); iter != baseline.constEnd(); ++iter)
+    {
+      DREAM3D_REQUIRE(iter.key().endsWith(".py"))
+      DREAM3D_REQUIRE(iter.value() == PythonFilterWatcher::HashFile(iter.key()))
+    }
+
+    // Saving a file without edits is not a change
+    QString unchangedPath = dir.absoluteFilePath("Filter3.py");
+    QString editedPath = dir.absoluteFilePath("Filter7.py");
+    QString removedPath = dir.absoluteFilePath("Filter11.py");
+    QString addedPath = dir.absoluteFilePath("NewFilter.py");
+    DREAM3D_REQUIRE(writeFile(unchangedPath, "# Filter 3\n"))
+    DREAM3D_REQUIRE(writeFile(editedPath, "# Filter 7 was edited\n"))
+    DREAM3D_REQUIRE(QFile::remove(removedPath))
+    DREAM3D_REQUIRE(writeFile(addedPath, "# New filter\n"))
+
+    PythonFilterWatcher::FileHashes current = PythonFilterWatcher::ScanSearchPaths({tempDir.path()});
+    QStringList changedFiles;
+    QStringList removedFiles;
+    PythonFilterWatcher::DiffFileHashes(baseline, current, &changedFiles, &removedFiles);
+    DREAM3D_REQUIRE(changedFiles == QStringList({editedPath, addedPath}))
+    DREAM3D_REQUIRE(removedFiles == QStringList({removedPath}))
+
+    DREAM3D_REQUIRE(PythonFilterWatcher::ScanSearchPaths(QStringList()).isEmpty())
+    DREAM3D_REQUIRE(PythonFilterWatcher::HashFile(dir.filePath("Missing.py")).isEmpty())
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestDiffFileHashes())
+    DREAM3D_REGISTER_TEST(TestScanSearchPaths())
+  }
+};
@@ -0,0 +1,151 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
+
+#include "UnitTestSupport.hpp"
+
+#include "SIMPLView/SIMPLViewThreadBudget.h"
+
+class SIMPLViewThreadBudgetTest
+{
+public:
+  SIMPLViewThreadBudgetTest() = default;
+  ~SIMPLViewThreadBudgetTest() = default;
+  SIMPLViewThreadBudgetTest(const SIMPLViewThreadBudgetTest&) = delete;            // Copy Constructor
+  SIMPLViewThreadBudgetTest(SIMPLViewThreadBudgetTest&&) = delete;                 // Move Constructor
+  SIMPLViewThreadBudgetTest& operator=(const SIMPLViewThreadBudgetTest&) = delete; // Copy Assignment
+  SIMPLViewThreadBudgetTest& operator=(SIMPLViewThreadBudgetTest&&) = delete;      // Move Assignment
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestParseCpuList()
+  {
+    bool ok = false;
+    QVector<int> cpus = SIMPLViewThreadBudget::ParseCpuList("0-3,8,10-11", 16, &ok);
+    DREAM3D_REQUIRE(ok)
+    DREAM3D_REQUIRE(cpus == QVector<int>({0, 1, 2, 3, 8, 10, 11}))
+
+    // Overlapping ranges are merged and the result is sorted
+    cpus = SIMPLViewThreadBudget::ParseCpuList("5,1-3,2", 16, &ok);
+    DREAM3D_REQUIRE(ok)
+    DREAM3D_REQUIRE(cpus == QVector<int>({1, 2, 3, 5}))
+
+    // An empty list is valid and means every CPU
+    cpus = SIMPLViewThreadBudget::ParseCpuList("", 16, &ok);
+    DREAM3D_REQUIRE(ok)
+    DREAM3D_REQUIRE(cpus.isEmpty())
+
+    const QStringList invalidLists = {"a", "3-1", "-1", "1-", "0-1-2", "1,,x"};
+    for(const QString& cpuList : invalidLists)
+    {
+      ok = true;
+      cpus = SIMPLViewThreadBudget::ParseCpuList(cpuList, 16, &ok);
+      DREAM3D_REQUIRE(!ok)
+      DREAM3D_REQUIRE(cpus.isEmpty())
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestParseCpuListBounds()
+  {
+    bool ok = false;
+    QVector<int> cpus = SIMPLViewThreadBudget::ParseCpuList("15", 16, &ok);
+    DREAM3D_REQUIRE(ok)
+    DREAM3D_REQUIRE_EQUAL(cpus.size(), 1)
+
+    cpus = SIMPLViewThreadBudget::ParseCpuList("16", 16, &ok);
+    DREAM3D_REQUIRE(!ok)
+    DREAM3D_REQUIRE(cpus.isEmpty())
+
+    // A huge range must be rejected before it is expanded
+    cpus = SIMPLViewThreadBudget::ParseCpuList("0-2000000000", 16, &ok);
+    DREAM3D_REQUIRE(!ok)
+    DREAM3D_REQUIRE(cpus.isEmpty())
+
+    cpus = SIMPLViewThreadBudget::ParseCpuList("0-3,8-20", 16, &ok);
+    DREAM3D_REQUIRE(!ok)
+    DREAM3D_REQUIRE(cpus.isEmpty())
+
+    DREAM3D_REQUIRE(SIMPLViewThreadBudget::CpuCount() >= 1)
+    DREAM3D_REQUIRE(SIMPLViewThreadBudget::IdealThreadCount() >= 1)
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestApplicationPool()
+  {
+    QThreadPool* pool = SIMPLViewThreadBudget::ApplicationPool();
+    DREAM3D_REQUIRE(pool != nullptr)
+    DREAM3D_REQUIRE(pool == SIMPLViewThreadBudget::ApplicationPool())
+    DREAM3D_REQUIRE(pool != QThreadPool::globalInstance())
+
+    // The budget caps the pipelines' pool but leaves the application pool alone
+    int applicationThreads = pool->maxThreadCount();
+    {
+      SIMPLViewThreadBudget budget;
+      budget.setMaxThreadCount(1);
+      DREAM3D_REQUIRE_EQUAL(budget.getEffectiveThreadCount(), 1)
+      DREAM3D_REQUIRE_EQUAL(QThreadPool::globalInstance()->maxThreadCount(), 1)
+      DREAM3D_REQUIRE_EQUAL(pool->maxThreadCount(), applicationThreads)
+      budget.setMaxThreadCount(0);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestParseCpuList())
+    DREAM3D_REGISTER_TEST(TestParseCpuListBounds())
+    DREAM3D_REGISTER_TEST(TestApplicationPool())
+  }
+};